@@ -14,6 +14,8 @@ The following import targets are created
   cppgraphqlgen::graphqlservice
   cppgraphqlgen::graphqlintrospection
   cppgraphqlgen::graphqljson
+  cppgraphqlgen::graphqlcbor
+  cppgraphqlgen::graphqlmessagepack
   cppgraphqlgen::schemagen
 #]=======================================================================]
 
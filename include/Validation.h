@@ -164,33 +164,61 @@ private:
 	ValidateType _variableType;
 };
 
+// ValidationContext stores the Introspection schema information which does not change between
+// queries. The Request builds it once and shares it with every ValidateExecutableVisitor, so it's
+// never modified after construction and multiple threads can validate queries at the same time.
+struct ValidationContext
+{
+	explicit ValidationContext(const std::shared_ptr<schema::Schema>& schema);
+
+	using FieldTypes = internal::string_view_map<ValidateTypeField>;
+	using TypeFields = internal::string_view_map<FieldTypes>;
+	using InputFieldTypes = ValidateTypeFieldArguments;
+	using InputTypeFields = internal::string_view_map<InputFieldTypes>;
+	using EnumValues = internal::string_view_map<internal::string_view_set>;
+	using Directives = internal::string_view_map<ValidateDirective>;
+	using MatchingTypes = internal::string_view_map<internal::string_view_set>;
+	using ScalarTypes = internal::string_view_set;
+
+	const std::shared_ptr<schema::Schema> schema;
+	ValidateTypes operationTypes;
+	ValidateTypes types;
+	MatchingTypes matchingTypes;
+	Directives directives;
+	EnumValues enumValues;
+	ScalarTypes scalarTypes;
+	TypeFields typeFields;
+	InputTypeFields inputTypeFields;
+
+private:
+	static ValidateTypeFieldArguments getArguments(
+		const std::vector<std::shared_ptr<const schema::InputValue>>& args);
+
+	FieldTypes getTypeFields(const schema::BaseType& type) const;
+};
+
 // ValidateExecutableVisitor visits the AST and validates that it is executable against the service
-// schema.
+// schema. It keeps state for a single query, so each call to Request::validate uses a new instance.
 class ValidateExecutableVisitor
 {
 public:
-	ValidateExecutableVisitor(const std::shared_ptr<schema::Schema>& schema);
+	explicit ValidateExecutableVisitor(const ValidationContext& context);
 
 	void visit(const peg::ast_node& root);
 
 	std::list<schema_error> getStructuredErrors();
 
 private:
-	static ValidateTypeFieldArguments getArguments(
-		const std::vector<std::shared_ptr<const schema::InputValue>>& args);
-
-	using FieldTypes = internal::string_view_map<ValidateTypeField>;
-	using TypeFields = internal::string_view_map<FieldTypes>;
-	using InputFieldTypes = ValidateTypeFieldArguments;
-	using InputTypeFields = internal::string_view_map<InputFieldTypes>;
-	using EnumValues = internal::string_view_map<internal::string_view_set>;
-
-	constexpr bool isScalarType(introspection::TypeKind kind);
+	using FieldTypes = ValidationContext::FieldTypes;
+	using TypeFields = ValidationContext::TypeFields;
+	using InputFieldTypes = ValidationContext::InputFieldTypes;
+	using InputTypeFields = ValidationContext::InputTypeFields;
+	using EnumValues = ValidationContext::EnumValues;
 
 	bool matchesScopedType(std::string_view name) const;
 
-	TypeFields::const_iterator getScopedTypeFields();
-	InputTypeFields::const_iterator getInputTypeFields(std::string_view name);
+	TypeFields::const_iterator getScopedTypeFields() const;
+	InputTypeFields::const_iterator getInputTypeFields(std::string_view name) const;
 	static const ValidateType& getValidateFieldType(const FieldTypes::mapped_type& value);
 	static const ValidateType& getValidateFieldType(const InputFieldTypes::mapped_type& value);
 	template <class _FieldTypes>
@@ -215,30 +243,32 @@ private:
 	bool validateVariableType(bool isNonNull, const ValidateType& variableType,
 		const schema_location& position, const ValidateType& inputType);
 
-	const std::shared_ptr<schema::Schema> _schema;
-	std::list<schema_error> _errors;
-
-	using Directives = internal::string_view_map<ValidateDirective>;
+	using Directives = ValidationContext::Directives;
 	using AstNodeRef = std::reference_wrapper<const peg::ast_node>;
 	using ExecutableNodes = internal::string_view_map<AstNodeRef>;
 	using FragmentSet = internal::string_view_set;
-	using MatchingTypes = internal::string_view_map<internal::string_view_set>;
-	using ScalarTypes = internal::string_view_set;
+	using MatchingTypes = ValidationContext::MatchingTypes;
+	using ScalarTypes = ValidationContext::ScalarTypes;
 	using VariableDefinitions = internal::string_view_map<AstNodeRef>;
 	using VariableTypes = internal::string_view_map<ValidateArgument>;
 	using OperationVariables = std::optional<VariableTypes>;
 	using VariableSet = internal::string_view_set;
 
-	// These members store Introspection schema information which does not change between queries.
-	ValidateTypes _operationTypes;
-	ValidateTypes _types;
-	MatchingTypes _matchingTypes;
-	Directives _directives;
-	EnumValues _enumValues;
-	ScalarTypes _scalarTypes;
+	// These members reference the Introspection schema information in the shared
+	// ValidationContext, which does not change between queries.
+	const std::shared_ptr<schema::Schema>& _schema;
+	const ValidateTypes& _operationTypes;
+	const ValidateTypes& _types;
+	const MatchingTypes& _matchingTypes;
+	const Directives& _directives;
+	const EnumValues& _enumValues;
+	const ScalarTypes& _scalarTypes;
+	const TypeFields& _typeFields;
+	const InputTypeFields& _inputTypeFields;
+
+	std::list<schema_error> _errors;
 
-	// These members store information that's specific to a single query and changes every time we
-	// visit a new one. They must be reset in between queries.
+	// These members store information that's specific to the query being validated.
 	ExecutableNodes _fragmentDefinitions;
 	ExecutableNodes _operationDefinitions;
 	FragmentSet _referencedFragments;
@@ -250,8 +280,6 @@ private:
 	VariableSet _referencedVariables;
 	FragmentSet _fragmentStack;
 	size_t _fieldCount = 0;
-	TypeFields _typeFields;
-	InputTypeFields _inputTypeFields;
 	ValidateType _scopedType;
 	internal::string_view_map<ValidateField> _selectionFields;
 };
@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#ifndef CBORRESPONSE_H
+#define CBORRESPONSE_H
+
+// clang-format off
+#ifdef GRAPHQL_DLLEXPORTS
+	#ifdef IMPL_CBORRESPONSE_DLL
+		#define CBORRESPONSE_EXPORT __declspec(dllexport)
+	#else // !IMPL_CBORRESPONSE_DLL
+		#define CBORRESPONSE_EXPORT __declspec(dllimport)
+	#endif // !IMPL_CBORRESPONSE_DLL
+#else // !GRAPHQL_DLLEXPORTS
+	#define CBORRESPONSE_EXPORT
+#endif // !GRAPHQL_DLLEXPORTS
+// clang-format on
+
+#include "graphqlservice/GraphQLResponse.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace graphql::response {
+
+// CBOR (RFC 8949) doesn't distinguish between Type::String and Type::EnumValue, or between a
+// Type::Scalar and the value it wraps, so toCBOR marks them with these tags. They are in the
+// first come first served range of the IANA registry, but they aren't registered, so any other
+// CBOR decoder should just ignore them and read the tagged text string or value.
+constexpr std::uint64_t CBORTagEnumValue = 0xC7A0;
+constexpr std::uint64_t CBORTagScalar = 0xC7A1;
+
+CBORRESPONSE_EXPORT std::vector<std::uint8_t> toCBOR(Value&& response);
+
+// Throws std::runtime_error if the input isn't a single well-formed CBOR data item, or if it uses
+// a type which doesn't map to a Value, such as a byte string. Integers outside of the 32-bit range
+// supported by GraphQL throw std::overflow_error.
+CBORRESPONSE_EXPORT Value parseCBOR(const std::vector<std::uint8_t>& cbor);
+
+} /* namespace graphql::response */
+
+#endif // CBORRESPONSE_H
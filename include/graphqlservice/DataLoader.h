@@ -0,0 +1,329 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#ifndef DATALOADER_H
+#define DATALOADER_H
+
+#include "graphqlservice/GraphQLService.h"
+
+#include <unordered_map>
+
+namespace graphql::service {
+
+// DataLoader batches and caches the keys which field accessors request from a backend. Each call
+// to load returns a deferred FieldResult, and all of the keys which are still pending are passed to
+// a single call to the batch function the first time anyone waits on one of them.
+//
+// If the DataLoader is registered with the RequestState, the graphqlservice library also dispatches
+// the pending keys once it has visited every field in a selection set, or every element of a list.
+// With std::launch::async or an Executor, another thread may start waiting on the first element
+// before the rest of the list has been visited, so it waits for that dispatch instead of loading a
+// partial batch. Without a RequestState, the first thread which waits loads whatever is pending.
+//
+// Loaded values are cached until the DataLoader is destroyed or cleared, so it should usually be
+// scoped to a single request, e.g. as a member of your own subclass of RequestState. Keys which
+// fail to load are removed from the cache, so the next call to load tries them again. All of the
+// methods may be called concurrently from multiple threads.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class DataLoader
+{
+public:
+	// The batch function must return the values in the same order as the keys. It is called
+	// without holding any locks, and if it throws an exception, that exception is propagated to
+	// every FieldResult in the batch.
+	using BatchFunction = std::function<std::vector<Value>(std::vector<Key>&& keys)>;
+
+	explicit DataLoader(BatchFunction&& batch)
+		: _state { std::make_shared<State>(std::move(batch), nullptr) }
+	{
+	}
+
+	// Register the DataLoader with the BatchDispatcher in the RequestState. This should be called
+	// from the constructor of the RequestState, before it's used to resolve a request.
+	explicit DataLoader(RequestState& requestState, BatchFunction&& batch)
+		: _state { std::make_shared<State>(std::move(batch), registerState(requestState)) }
+	{
+		requestState.batches->add([weakState = std::weak_ptr<State> { _state }]() {
+			if (auto state = weakState.lock())
+			{
+				state->dispatch();
+			}
+		});
+	}
+
+	// Load a single value. If the key has already been loaded, the result is ready immediately.
+	FieldResult<Value> load(Key key)
+	{
+		auto value = _state->find(std::move(key));
+
+		if (value.wait_for(std::chrono::seconds { 0 }) == std::future_status::ready)
+		{
+			return Value { value.get() };
+		}
+
+		return std::async(
+			std::launch::deferred,
+			[](std::shared_ptr<State>&& state, std::shared_future<Value>&& pending) {
+				state->prepareWait();
+
+				return Value { pending.get() };
+			},
+			std::shared_ptr<State> { _state },
+			std::move(value));
+	}
+
+	// Load multiple values in the same batch.
+	FieldResult<std::vector<Value>> loadMany(std::vector<Key> keys)
+	{
+		std::vector<std::shared_future<Value>> values;
+
+		values.reserve(keys.size());
+
+		for (auto& key : keys)
+		{
+			values.push_back(_state->find(std::move(key)));
+		}
+
+		return std::async(
+			std::launch::deferred,
+			[](std::shared_ptr<State>&& state, std::vector<std::shared_future<Value>>&& pending) {
+				std::vector<Value> result;
+
+				state->prepareWait();
+				result.reserve(pending.size());
+
+				for (const auto& value : pending)
+				{
+					result.push_back(value.get());
+				}
+
+				return result;
+			},
+			std::shared_ptr<State> { _state },
+			std::move(values));
+	}
+
+	// Call the batch function for any keys which are still pending, without waiting for someone
+	// to ask for one of the results.
+	void dispatch()
+	{
+		_state->dispatch();
+	}
+
+	// Add a value to the cache, e.g. if it was loaded some other way. Returns false if the key was
+	// already in the cache.
+	bool prime(Key key, Value value)
+	{
+		return _state->prime(std::move(key), std::move(value));
+	}
+
+	// Remove a key from the cache, so the next call to load will fetch it again. Keys which are
+	// still waiting for the next batch stay in the cache, since that batch will fetch them anyway.
+	void clear(const Key& key)
+	{
+		_state->clear(key);
+	}
+
+	void clear()
+	{
+		_state->clear();
+	}
+
+private:
+	static std::shared_ptr<BatchDispatcher> registerState(RequestState& requestState)
+	{
+		if (!requestState.batches)
+		{
+			requestState.batches = std::make_shared<BatchDispatcher>();
+		}
+
+		return requestState.batches;
+	}
+
+	// The deferred results share ownership of the state, so they can still be resolved after the
+	// DataLoader itself is destroyed. The BatchDispatcher only holds a weak reference to the state.
+	class State
+	{
+	public:
+		explicit State(BatchFunction&& batch, std::shared_ptr<BatchDispatcher>&& dispatcher)
+			: _batch { std::move(batch) }
+			, _dispatcher { std::move(dispatcher) }
+		{
+		}
+
+		// Called before waiting on a pending result. If the graphqlservice library is still
+		// visiting the siblings of this field on another thread, it will dispatch the batch when
+		// it's done, otherwise this thread needs to do it.
+		void prepareWait()
+		{
+			if (!_dispatcher || _dispatcher->shouldDispatch())
+			{
+				dispatch();
+			}
+		}
+
+		std::shared_future<Value> find(Key&& key)
+		{
+			std::lock_guard lock { _stateMutex };
+			auto itr = _cache.find(key);
+
+			if (itr != _cache.end())
+			{
+				return itr->second.value;
+			}
+
+			std::promise<Value> promise;
+			auto value = promise.get_future().share();
+
+			_cache.emplace(key, CacheEntry { value, true });
+			_pending.emplace_back(std::move(key), std::move(promise));
+
+			return value;
+		}
+
+		void dispatch()
+		{
+			std::vector<std::pair<Key, std::promise<Value>>> pending;
+			size_t batchId = 0;
+
+			{
+				std::lock_guard lock { _stateMutex };
+
+				pending = std::move(_pending);
+				_pending.clear();
+				batchId = ++_batchCount;
+
+				for (const auto& entry : pending)
+				{
+					auto& cacheEntry = _cache.find(entry.first)->second;
+
+					cacheEntry.pending = false;
+					cacheEntry.batchId = batchId;
+				}
+			}
+
+			if (pending.empty())
+			{
+				return;
+			}
+
+			std::vector<Key> keys;
+
+			keys.reserve(pending.size());
+
+			for (const auto& entry : pending)
+			{
+				keys.push_back(entry.first);
+			}
+
+			size_t fulfilled = 0;
+
+			try
+			{
+				auto values = _batch(std::move(keys));
+
+				if (values.size() != pending.size())
+				{
+					throw std::logic_error(
+						"DataLoader batch function returned the wrong number of values");
+				}
+
+				for (auto& value : values)
+				{
+					pending[fulfilled].second.set_value(std::move(value));
+					++fulfilled;
+				}
+			}
+			catch (...)
+			{
+				const auto ex = std::current_exception();
+
+				{
+					// Don't cache the failures, so loading the same keys again retries them. If a
+					// key was cleared and loaded again since this batch started, it's not from
+					// this batch anymore.
+					std::lock_guard lock { _stateMutex };
+
+					for (auto itr = pending.begin() + fulfilled; itr != pending.end(); ++itr)
+					{
+						const auto itrCache = _cache.find(itr->first);
+
+						if (itrCache != _cache.end() && itrCache->second.batchId == batchId)
+						{
+							_cache.erase(itrCache);
+						}
+					}
+				}
+
+				for (auto itr = pending.begin() + fulfilled; itr != pending.end(); ++itr)
+				{
+					itr->second.set_exception(ex);
+				}
+			}
+		}
+
+		bool prime(Key&& key, Value&& value)
+		{
+			std::lock_guard lock { _stateMutex };
+
+			if (_cache.find(key) != _cache.end())
+			{
+				return false;
+			}
+
+			std::promise<Value> promise;
+
+			promise.set_value(std::move(value));
+			_cache.emplace(std::move(key), CacheEntry { promise.get_future().share() });
+
+			return true;
+		}
+
+		void clear(const Key& key)
+		{
+			std::lock_guard lock { _stateMutex };
+			const auto itr = _cache.find(key);
+
+			if (itr != _cache.end() && !itr->second.pending)
+			{
+				_cache.erase(itr);
+			}
+		}
+
+		void clear()
+		{
+			std::lock_guard lock { _stateMutex };
+
+			for (auto itr = _cache.begin(); itr != _cache.end();)
+			{
+				itr = (itr->second.pending ? std::next(itr) : _cache.erase(itr));
+			}
+		}
+
+	private:
+		// If a pending key were removed from the cache, loading it again before the next batch
+		// would add it to that batch twice.
+		struct CacheEntry
+		{
+			std::shared_future<Value> value;
+			bool pending = false;
+			size_t batchId = 0;
+		};
+
+		const BatchFunction _batch;
+		const std::shared_ptr<BatchDispatcher> _dispatcher;
+
+		std::mutex _stateMutex;
+		std::unordered_map<Key, CacheEntry, Hash> _cache;
+		std::vector<std::pair<Key, std::promise<Value>>> _pending;
+		size_t _batchCount = 0;
+	};
+
+	const std::shared_ptr<State> _state;
+};
+
+} /* namespace graphql::service */
+
+#endif // DATALOADER_H
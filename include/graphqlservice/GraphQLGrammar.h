@@ -16,6 +16,7 @@
 #include <tao/pegtl.hpp>
 #include <tao/pegtl/contrib/parse_tree.hpp>
 
+#include <cstring>
 #include <functional>
 
 namespace graphql::peg {
@@ -59,18 +60,91 @@ void on_first_child(const ast_node& n, std::function<void(const ast_node&)>&& fu
 	}
 }
 
+// Character classes which the lexer can skip in bulk.
+enum class scan_class
+{
+	// Whitespace and commas in Ignored tokens.
+	ignored,
+
+	// ASCII characters in a quoted string, except for the quote and backslash.
+	string_character,
+
+	// ASCII characters in a block string, including line terminators, except for the quote and
+	// backslash.
+	block_string_character,
+};
+
+// Count the leading bytes in [begin, end) which are all in the same scan_class. This uses AVX2 or
+// SSE2 depending on what the CPU supports at runtime, with a scalar fallback on other targets.
+[[nodiscard]] GRAPHQLPEG_EXPORT size_t scan_run(
+	scan_class characters, const char* begin, const char* end) noexcept;
+
+// Fast path rules which skip a run of characters in the scan_class all at once. The grammar falls
+// back to the spec rules one character at a time for anything else, e.g. UTF-8 sequences.
+template <scan_class Characters>
+struct scan_run_rule : plus<any>
+{
+	template <typename ParseInput>
+	[[nodiscard]] static bool match(ParseInput& in) noexcept
+	{
+		const auto count = scan_run(Characters, in.current(), in.end());
+
+		if (count == 0)
+		{
+			return false;
+		}
+
+		if constexpr (Characters == scan_class::string_character)
+		{
+			in.bump_in_this_line(count);
+		}
+		else
+		{
+			in.bump(count);
+		}
+
+		return true;
+	}
+};
+
 // http://spec.graphql.org/June2018/#sec-Source-Text
 struct source_character : sor<one<0x0009, 0x000A, 0x000D>, utf8::range<0x0020, 0xFFFF>>
 {
 };
 
+// Skip everything in a comment up to the line terminator with std::memchr, which the standard
+// library already vectorizes.
+struct comment_text : star<any>
+{
+	template <typename ParseInput>
+	[[nodiscard]] static bool match(ParseInput& in) noexcept
+	{
+		const char* begin = in.current();
+		const auto size = static_cast<size_t>(in.end() - begin);
+		auto end = static_cast<const char*>(std::memchr(begin, '\n', size));
+
+		if (!end)
+		{
+			end = begin + size;
+		}
+		else if (end != begin && *(end - 1) == '\r')
+		{
+			--end;
+		}
+
+		in.bump_in_this_line(static_cast<size_t>(end - begin));
+
+		return true;
+	}
+};
+
 // http://spec.graphql.org/June2018/#sec-Comments
-struct comment : seq<one<'#'>, until<eolf>>
+struct comment : seq<one<'#'>, comment_text, eolf>
 {
 };
 
 // http://spec.graphql.org/June2018/#sec-Source-Text.Ignored-Tokens
-struct ignored : sor<space, one<','>, comment>
+struct ignored : sor<scan_run_rule<scan_class::ignored>, comment>
 {
 };
 
@@ -128,7 +202,8 @@ struct string_escape_sequence : if_must<backslash_token, string_escape_sequence_
 };
 
 struct string_quote_character
-	: plus<not_at<backslash_token>, not_at<quote_token>, not_at<ascii::eol>, source_character>
+	: plus<sor<scan_run_rule<scan_class::string_character>,
+		  seq<not_at<backslash_token>, not_at<quote_token>, not_at<ascii::eol>, source_character>>>
 {
 };
 
@@ -151,7 +226,8 @@ struct block_escape_sequence : seq<backslash_token, block_quote_token>
 };
 
 struct block_quote_character
-	: plus<not_at<block_quote_token>, not_at<block_escape_sequence>, source_character>
+	: plus<sor<scan_run_rule<scan_class::block_string_character>,
+		  seq<not_at<block_quote_token>, not_at<block_escape_sequence>, source_character>>>
 {
 };
 
@@ -1175,6 +1251,156 @@ struct schema_document : must<schema_document_content>
 {
 };
 
+// IDs for the rules which may be selected by ast_selector, schema_selector, or executable_selector.
+template <>
+inline constexpr ast_rule ast_rule_id<operation_type> = ast_rule::operation_type;
+template <>
+inline constexpr ast_rule ast_rule_id<list_value> = ast_rule::list_value;
+template <>
+inline constexpr ast_rule ast_rule_id<object_field_name> = ast_rule::object_field_name;
+template <>
+inline constexpr ast_rule ast_rule_id<object_field> = ast_rule::object_field;
+template <>
+inline constexpr ast_rule ast_rule_id<object_value> = ast_rule::object_value;
+template <>
+inline constexpr ast_rule ast_rule_id<variable_value> = ast_rule::variable_value;
+template <>
+inline constexpr ast_rule ast_rule_id<integer_value> = ast_rule::integer_value;
+template <>
+inline constexpr ast_rule ast_rule_id<float_value> = ast_rule::float_value;
+template <>
+inline constexpr ast_rule ast_rule_id<escaped_unicode> = ast_rule::escaped_unicode;
+template <>
+inline constexpr ast_rule ast_rule_id<escaped_char> = ast_rule::escaped_char;
+template <>
+inline constexpr ast_rule ast_rule_id<string_quote_character> = ast_rule::string_quote_character;
+template <>
+inline constexpr ast_rule ast_rule_id<block_escape_sequence> = ast_rule::block_escape_sequence;
+template <>
+inline constexpr ast_rule ast_rule_id<block_quote_character> = ast_rule::block_quote_character;
+template <>
+inline constexpr ast_rule ast_rule_id<string_value> = ast_rule::string_value;
+template <>
+inline constexpr ast_rule ast_rule_id<true_keyword> = ast_rule::true_keyword;
+template <>
+inline constexpr ast_rule ast_rule_id<false_keyword> = ast_rule::false_keyword;
+template <>
+inline constexpr ast_rule ast_rule_id<null_keyword> = ast_rule::null_keyword;
+template <>
+inline constexpr ast_rule ast_rule_id<enum_value> = ast_rule::enum_value;
+template <>
+inline constexpr ast_rule ast_rule_id<field_name> = ast_rule::field_name;
+template <>
+inline constexpr ast_rule ast_rule_id<argument_name> = ast_rule::argument_name;
+template <>
+inline constexpr ast_rule ast_rule_id<argument> = ast_rule::argument;
+template <>
+inline constexpr ast_rule ast_rule_id<arguments> = ast_rule::arguments;
+template <>
+inline constexpr ast_rule ast_rule_id<directive_name> = ast_rule::directive_name;
+template <>
+inline constexpr ast_rule ast_rule_id<directive> = ast_rule::directive;
+template <>
+inline constexpr ast_rule ast_rule_id<directives> = ast_rule::directives;
+template <>
+inline constexpr ast_rule ast_rule_id<variable> = ast_rule::variable;
+template <>
+inline constexpr ast_rule ast_rule_id<scalar_name> = ast_rule::scalar_name;
+template <>
+inline constexpr ast_rule ast_rule_id<named_type> = ast_rule::named_type;
+template <>
+inline constexpr ast_rule ast_rule_id<list_type> = ast_rule::list_type;
+template <>
+inline constexpr ast_rule ast_rule_id<nonnull_type> = ast_rule::nonnull_type;
+template <>
+inline constexpr ast_rule ast_rule_id<default_value> = ast_rule::default_value;
+template <>
+inline constexpr ast_rule ast_rule_id<operation_definition> = ast_rule::operation_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<fragment_definition> = ast_rule::fragment_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<schema_definition> = ast_rule::schema_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<scalar_type_definition> = ast_rule::scalar_type_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<object_type_definition> = ast_rule::object_type_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<interface_type_definition> = ast_rule::interface_type_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<union_type_definition> = ast_rule::union_type_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<enum_type_definition> = ast_rule::enum_type_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<input_object_type_definition> = ast_rule::input_object_type_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<directive_definition> = ast_rule::directive_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<schema_extension> = ast_rule::schema_extension;
+template <>
+inline constexpr ast_rule ast_rule_id<scalar_type_extension> = ast_rule::scalar_type_extension;
+template <>
+inline constexpr ast_rule ast_rule_id<object_type_extension> = ast_rule::object_type_extension;
+template <>
+inline constexpr ast_rule ast_rule_id<interface_type_extension> = ast_rule::interface_type_extension;
+template <>
+inline constexpr ast_rule ast_rule_id<union_type_extension> = ast_rule::union_type_extension;
+template <>
+inline constexpr ast_rule ast_rule_id<enum_type_extension> = ast_rule::enum_type_extension;
+template <>
+inline constexpr ast_rule ast_rule_id<input_object_type_extension> = ast_rule::input_object_type_extension;
+template <>
+inline constexpr ast_rule ast_rule_id<description> = ast_rule::description;
+template <>
+inline constexpr ast_rule ast_rule_id<object_name> = ast_rule::object_name;
+template <>
+inline constexpr ast_rule ast_rule_id<interface_name> = ast_rule::interface_name;
+template <>
+inline constexpr ast_rule ast_rule_id<union_name> = ast_rule::union_name;
+template <>
+inline constexpr ast_rule ast_rule_id<enum_name> = ast_rule::enum_name;
+template <>
+inline constexpr ast_rule ast_rule_id<root_operation_definition> = ast_rule::root_operation_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<interface_type> = ast_rule::interface_type;
+template <>
+inline constexpr ast_rule ast_rule_id<input_field_definition> = ast_rule::input_field_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<input_fields_definition> = ast_rule::input_fields_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<arguments_definition> = ast_rule::arguments_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<field_definition> = ast_rule::field_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<fields_definition> = ast_rule::fields_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<union_type> = ast_rule::union_type;
+template <>
+inline constexpr ast_rule ast_rule_id<enum_value_definition> = ast_rule::enum_value_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<directive_location> = ast_rule::directive_location;
+template <>
+inline constexpr ast_rule ast_rule_id<operation_type_definition> = ast_rule::operation_type_definition;
+template <>
+inline constexpr ast_rule ast_rule_id<variable_name> = ast_rule::variable_name;
+template <>
+inline constexpr ast_rule ast_rule_id<alias_name> = ast_rule::alias_name;
+template <>
+inline constexpr ast_rule ast_rule_id<alias> = ast_rule::alias;
+template <>
+inline constexpr ast_rule ast_rule_id<operation_name> = ast_rule::operation_name;
+template <>
+inline constexpr ast_rule ast_rule_id<fragment_name> = ast_rule::fragment_name;
+template <>
+inline constexpr ast_rule ast_rule_id<field> = ast_rule::field;
+template <>
+inline constexpr ast_rule ast_rule_id<fragment_spread> = ast_rule::fragment_spread;
+template <>
+inline constexpr ast_rule ast_rule_id<inline_fragment> = ast_rule::inline_fragment;
+template <>
+inline constexpr ast_rule ast_rule_id<selection_set> = ast_rule::selection_set;
+template <>
+inline constexpr ast_rule ast_rule_id<type_condition> = ast_rule::type_condition;
+
 } /* namespace graphql::peg */
 
 #endif // GRAPHQLGRAMMAR_H
@@ -18,10 +18,20 @@
 #endif // !GRAPHQL_DLLEXPORTS
 // clang-format on
 
+#include <cstddef>
+#include <limits>
 #include <memory>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace graphql {
+namespace service {
+
+struct ExecutionPlan;
+
+} /* namespace service */
+
 namespace peg {
 
 class ast_node;
@@ -32,13 +42,61 @@ struct ast
 	std::shared_ptr<ast_input> input;
 	std::shared_ptr<ast_node> root;
 	bool validated = false;
+
+	// The parser accepts both executable and type system definitions in a single pass, and it
+	// records which kinds of definitions it found. Request::validate rejects a document without
+	// any executable definitions before applying the other validation rules, and schemagen rejects
+	// a schema with executable definitions before it visits any of the types.
+	bool hasExecutableDefinitions = false;
+	bool hasTypeSystemDefinitions = false;
+
+	// Request::validate compiles an ExecutionPlan when the query passes validation and caches it
+	// here, so resolving the same query again doesn't need to walk the AST. If you set validated
+	// yourself, the next call to Request::validate or Request::resolve compiles the plan, so that
+	// first call must not overlap with any others on the same query.
+	std::shared_ptr<const service::ExecutionPlan> plan;
+};
+
+// Limits on the documents which the parser accepts, so a hostile document fails as soon as it
+// exceeds one of them instead of building a very deep or very large AST. The depth counts nested
+// selection sets, list and object values, and list types. The node limit counts every AST node the
+// parser matches, including the ones it discards when it backtracks, so it bounds the parsing work
+// as well as the size of the AST.
+struct parse_limits
+{
+	static constexpr size_t DefaultMaxDepth = 128;
+
+	size_t maxDepth = DefaultMaxDepth;
+	size_t maxNodes = std::numeric_limits<size_t>::max();
+	size_t maxBytes = std::numeric_limits<size_t>::max();
 };
 
-GRAPHQLPEG_EXPORT ast parseSchemaString(std::string_view input);
-GRAPHQLPEG_EXPORT ast parseSchemaFile(std::string_view filename);
+// The std::string_view overloads copy the document into the ast. If you already own the buffer,
+// you can move it into the ast instead, so it's parsed in place without making a copy.
+GRAPHQLPEG_EXPORT ast parseSchemaString(std::string_view input, const parse_limits& limits = {});
+GRAPHQLPEG_EXPORT ast parseSchemaString(std::string&& input, const parse_limits& limits = {});
+GRAPHQLPEG_EXPORT ast parseSchemaString(std::vector<char>&& input, const parse_limits& limits = {});
+GRAPHQLPEG_EXPORT ast parseSchemaFile(std::string_view filename, const parse_limits& limits = {});
+
+GRAPHQLPEG_EXPORT ast parseString(std::string_view input, const parse_limits& limits = {});
+GRAPHQLPEG_EXPORT ast parseString(std::string&& input, const parse_limits& limits = {});
+GRAPHQLPEG_EXPORT ast parseString(std::vector<char>&& input, const parse_limits& limits = {});
+GRAPHQLPEG_EXPORT ast parseFile(std::string_view filename, const parse_limits& limits = {});
+
+// String literals would be ambiguous between the std::string_view and std::string&& overloads.
+inline ast parseSchemaString(const char* input, const parse_limits& limits = {})
+{
+	return parseSchemaString(std::string_view { input }, limits);
+}
+
+inline ast parseString(const char* input, const parse_limits& limits = {})
+{
+	return parseString(std::string_view { input }, limits);
+}
 
-GRAPHQLPEG_EXPORT ast parseString(std::string_view input);
-GRAPHQLPEG_EXPORT ast parseFile(std::string_view filename);
+// Parse a document without copying it or taking ownership of it. The caller must keep the buffer
+// alive and unmodified until the ast and every copy of its root have been released.
+GRAPHQLPEG_EXPORT ast parseBorrowedString(std::string_view input, const parse_limits& limits = {});
 
 } /* namespace peg */
 
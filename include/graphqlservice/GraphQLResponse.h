@@ -234,6 +234,33 @@ private:
 	TypeData _data;
 };
 
+// A Writer receives a response document as a sequence of events in document order, so it can be
+// serialized without building a Value for the whole document first. Objects are written as a
+// start_object() call, followed by an add_member() call with the key before each member value,
+// and then an end_object() call. Lists are written as a start_list() call, followed by each of the
+// elements, and then an end_list() call.
+class Writer
+{
+public:
+	GRAPHQLRESPONSE_EXPORT virtual ~Writer();
+
+	virtual void start_object() = 0;
+	virtual void add_member(std::string_view key) = 0;
+	virtual void end_object() = 0;
+
+	virtual void start_list() = 0;
+	virtual void end_list() = 0;
+
+	virtual void write_null() = 0;
+	virtual void write_string(std::string_view value) = 0;
+	virtual void write_bool(BooleanType value) = 0;
+	virtual void write_int(IntType value) = 0;
+	virtual void write_float(FloatType value) = 0;
+
+	// Write all of the events for a Value, releasing each part of it once it has been written.
+	GRAPHQLRESPONSE_EXPORT void write(Value&& value);
+};
+
 #ifdef GRAPHQL_DLLEXPORTS
 // Export all of the specialized template methods
 template <>
@@ -70,6 +70,9 @@ private:
 	internal::string_view_map<size_t> _typeMap;
 	std::vector<std::pair<std::string_view, std::shared_ptr<const BaseType>>> _types;
 	std::vector<std::shared_ptr<const Directive>> _directives;
+
+	// Validating queries on multiple threads may wrap types at the same time.
+	std::mutex _wrapperMutex;
 	internal::sorted_map<std::shared_ptr<const BaseType>, std::shared_ptr<const BaseType>>
 		_nonNullWrappers;
 	internal::sorted_map<std::shared_ptr<const BaseType>, std::shared_ptr<const BaseType>>
@@ -24,6 +24,13 @@
 #include "graphqlservice/internal/SortedMap.h"
 #include "graphqlservice/internal/Version.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#ifdef GRAPHQL_USE_COROUTINES
+#include <coroutine>
+#endif // GRAPHQL_USE_COROUTINES
 #include <functional>
 #include <future>
 #include <list>
@@ -31,10 +38,12 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <queue>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <tuple>
 #include <variant>
@@ -61,9 +70,11 @@ struct schema_location
 // from an accessor as part of error reporting.
 using path_segment = std::variant<std::string_view, size_t>;
 
+// Each field_path shares ownership of its parent, so the error path stays valid in results which
+// are still pending after the selection set or list which launched them has been visited.
 struct field_path
 {
-	std::optional<std::reference_wrapper<const field_path>> parent;
+	std::shared_ptr<const field_path> parent;
 	std::variant<std::string_view, size_t> segment;
 };
 
@@ -100,12 +111,75 @@ private:
 	std::list<schema_error> _structuredErrors;
 };
 
+// Loaders which batch the keys requested by the field accessors, e.g. DataLoader, register with the
+// BatchDispatcher in the RequestState. The graphqlservice library dispatches all of their pending
+// keys after it has visited every field in a selection set, or every element in a list, so the keys
+// from all of those siblings are loaded in the same batch. While another thread is still visiting
+// them, a thread which waits for one of the results waits for that dispatch instead of loading a
+// partial batch on its own.
+class BatchDispatcher
+{
+public:
+	using DispatchCallback = std::function<void()>;
+
+	// Register a callback which loads all of the pending keys. This is not synchronized with the
+	// other methods, so the loaders should register before the RequestState is used to resolve a
+	// request, e.g. in the constructor of your RequestState.
+	GRAPHQLSERVICE_EXPORT void add(DispatchCallback&& dispatch);
+
+	// The graphqlservice library calls begin and end around visiting the siblings in a selection
+	// set or list. When the last of the nested or concurrent visits ends, it calls all of the
+	// DispatchCallbacks.
+	GRAPHQLSERVICE_EXPORT void begin() noexcept;
+	GRAPHQLSERVICE_EXPORT void end() noexcept;
+
+	// Returns true if a thread which needs one of the results should dispatch the pending keys
+	// itself, because no other thread is visiting a selection set or list, or because the calling
+	// thread is in the middle of visiting one and would never reach the end otherwise.
+	GRAPHQLSERVICE_EXPORT bool shouldDispatch() const noexcept;
+
+private:
+	std::vector<DispatchCallback> _callbacks;
+	std::atomic_size_t _visiting { 0 };
+};
+
 // The RequestState is nullable, but if you have multiple threads processing requests and there's
 // any per-request state that you want to maintain throughout the request (e.g. optimizing or
 // batching backend requests), you can inherit from RequestState and pass it to Request::resolve to
 // correlate the asynchronous/recursive callbacks and accumulate state in it.
 struct RequestState : std::enable_shared_from_this<RequestState>
 {
+	// Allocated by the first loader which registers with it, see BatchDispatcher.
+	std::shared_ptr<BatchDispatcher> batches;
+};
+
+// Hold the BatchDispatcher in the RequestState open while visiting the siblings in a selection set
+// or list, and dispatch the pending keys once all of the visits have ended.
+class BatchScope
+{
+public:
+	explicit BatchScope(const std::shared_ptr<RequestState>& state) noexcept
+		: _dispatcher { state ? state->batches.get() : nullptr }
+	{
+		if (_dispatcher)
+		{
+			_dispatcher->begin();
+		}
+	}
+
+	~BatchScope()
+	{
+		if (_dispatcher)
+		{
+			_dispatcher->end();
+		}
+	}
+
+	BatchScope(const BatchScope&) = delete;
+	BatchScope& operator=(const BatchScope&) = delete;
+
+private:
+	BatchDispatcher* const _dispatcher;
 };
 
 namespace {
@@ -122,6 +196,11 @@ constexpr std::string_view strPath { "path"sv };
 constexpr std::string_view strQuery { "query"sv };
 constexpr std::string_view strMutation { "mutation"sv };
 constexpr std::string_view strSubscription { "subscription"sv };
+constexpr std::string_view strHasNext { "hasNext"sv };
+constexpr std::string_view strItems { "items"sv };
+constexpr std::string_view strLabel { "label"sv };
+constexpr std::string_view strDefer { "defer"sv };
+constexpr std::string_view strStream { "stream"sv };
 
 } // namespace
 
@@ -146,6 +225,184 @@ enum class ResolverContext
 	NotifyUnsubscribe,
 };
 
+// An Executor schedules the async work of resolving a request, e.g. joining the results of the
+// fields in a selection set or the elements of a list. Without an Executor, std::launch::async
+// starts a new thread for every std::async call. With an Executor, that work is posted to the
+// Executor instead, so a single pool of worker threads can be shared across requests.
+class Executor
+{
+public:
+	GRAPHQLSERVICE_EXPORT virtual ~Executor();
+
+	// Queue a task to run on one of the worker threads.
+	virtual void post(std::function<void()>&& task) = 0;
+};
+
+// ThreadPoolExecutor is a simple Executor with a fixed number of worker threads sharing a single
+// queue of tasks.
+class ThreadPoolExecutor : public Executor
+{
+public:
+	GRAPHQLSERVICE_EXPORT explicit ThreadPoolExecutor(
+		size_t threadCount = std::thread::hardware_concurrency());
+	GRAPHQLSERVICE_EXPORT ~ThreadPoolExecutor() override;
+
+	GRAPHQLSERVICE_EXPORT void post(std::function<void()>&& task) override;
+
+private:
+	void runWorker();
+
+	std::mutex _taskMutex;
+	std::condition_variable _taskCondition;
+	std::queue<std::function<void()>> _tasks;
+	bool _stopping = false;
+	std::vector<std::thread> _workers;
+};
+
+// A task which has been posted to an Executor. It runs exactly once, on whichever thread gets to
+// it first: either one of the Executor worker threads, or a thread which is waiting for the result.
+template <typename Func>
+class ExecutorTask
+{
+public:
+	using result_type = std::invoke_result_t<Func&>;
+
+	explicit ExecutorTask(Func&& func)
+		: _func(std::move(func))
+	{
+	}
+
+	// Called from the Executor, does nothing if a waiting thread already claimed the task.
+	void run()
+	{
+		if (_claimed.exchange(true))
+		{
+			return;
+		}
+
+		try
+		{
+			if constexpr (std::is_void_v<result_type>)
+			{
+				_func();
+			}
+			else
+			{
+				_result.emplace(_func());
+			}
+		}
+		catch (...)
+		{
+			_exception = std::current_exception();
+		}
+
+		{
+			std::lock_guard lock(_resultMutex);
+
+			_ready = true;
+		}
+
+		_resultCondition.notify_all();
+	}
+
+	// Called from the waiting thread, runs the task inline if the Executor has not started it yet.
+	result_type get()
+	{
+		if (!_claimed.exchange(true))
+		{
+			return _func();
+		}
+
+		std::unique_lock lock(_resultMutex);
+
+		_resultCondition.wait(lock, [this]() noexcept {
+			return _ready;
+		});
+
+		if (_exception)
+		{
+			std::rethrow_exception(_exception);
+		}
+
+		if constexpr (!std::is_void_v<result_type>)
+		{
+			return std::move(*_result);
+		}
+	}
+
+private:
+	struct no_result
+	{
+	};
+
+	Func _func;
+	std::atomic_bool _claimed { false };
+	std::mutex _resultMutex;
+	std::condition_variable _resultCondition;
+	bool _ready = false;
+	std::optional<std::conditional_t<std::is_void_v<result_type>, no_result, result_type>> _result;
+	std::exception_ptr _exception;
+};
+
+// Post the function to the Executor and return a std::future which is satisfied by one of the
+// worker threads. Unlike launchAsync, the waiting thread never runs the function itself.
+template <typename Func, typename... Args>
+std::future<std::invoke_result_t<std::decay_t<Func>, std::decay_t<Args>...>> postTask(
+	const std::shared_ptr<Executor>& executor, Func&& func, Args&&... args)
+{
+	using result_type = std::invoke_result_t<std::decay_t<Func>, std::decay_t<Args>...>;
+
+	auto task = std::make_shared<std::packaged_task<result_type()>>(
+		[taskFunc = std::forward<Func>(func),
+			taskArgs = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+			return std::apply(std::move(taskFunc), std::move(taskArgs));
+		});
+	auto future = task->get_future();
+
+	executor->post([task]() {
+		(*task)();
+	});
+
+	return future;
+}
+
+// Call the function with std::async, or if there's an Executor and the launch policy allows
+// std::launch::async, post it to the Executor instead. Waiting for the result of a posted task runs
+// it on the waiting thread if none of the worker threads has started it yet, so nested results
+// never leave a bounded pool blocked on tasks which are still in the queue. Each posted task
+// allocates the shared ExecutorTask, the std::function which the Executor queues, and the
+// deferred std::future which waits on the ExecutorTask.
+template <typename Func, typename... Args>
+std::future<std::invoke_result_t<std::decay_t<Func>, std::decay_t<Args>...>> launchAsync(
+	const std::shared_ptr<Executor>& executor, std::launch launch, Func&& func, Args&&... args)
+{
+	if (executor && (launch & std::launch::async) == std::launch::async)
+	{
+		auto bound = [taskFunc = std::forward<Func>(func),
+						 taskArgs = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+			return std::apply(std::move(taskFunc), std::move(taskArgs));
+		};
+		auto task = std::make_shared<ExecutorTask<decltype(bound)>>(std::move(bound));
+
+		executor->post([task]() {
+			task->run();
+		});
+
+		return std::async(std::launch::deferred, [waitTask = std::move(task)]() {
+			return waitTask->get();
+		});
+	}
+
+	return std::async(launch, std::forward<Func>(func), std::forward<Args>(args)...);
+}
+
+// Compiled and cached representation of a validated query, see peg::ast::plan.
+struct ExecutionPlan;
+
+// Collects the results of @defer and @stream directives, see Request::resolve with an
+// IncrementalCallback.
+class IncrementalPayloads;
+
 // Pass a common bundle of parameters to all of the generated Object::getField accessors in a
 // SelectionSet
 struct SelectionSetParams
@@ -170,11 +427,31 @@ struct SelectionSetParams
 
 	// Async launch policy for sub-field resolvers.
 	const std::launch launch = std::launch::deferred;
+
+	// Optional Executor for sub-field resolvers, used in place of std::async when the launch
+	// policy is std::launch::async.
+	const std::shared_ptr<Executor> executor {};
+
+	// Compiled plan for the query, which is owned by the peg::ast. This is an implementation detail
+	// of the graphqlservice library and should be treated as opaque.
+	const ExecutionPlan* plan = nullptr;
+
+	// If the response is written to a response::Writer, selection sets and lists return their
+	// results in ResolverResult::pending instead of joining them in a response::Value.
+	const bool streaming = false;
+
+	// If the operation is resolved with an IncrementalCallback, fragments with @defer and list
+	// elements with @stream are added to this collection instead of the initial result. This is an
+	// implementation detail of the graphqlservice library and should be treated as opaque.
+	IncrementalPayloads* const incremental = nullptr;
 };
 
 // Pass a common bundle of parameters to all of the generated Object::getField accessors.
 struct FieldParams : SelectionSetParams
 {
+	// The generated resolvers keep using the ResolverParams after they build the FieldParams, so
+	// this copies the SelectionSetParams rather than moving them. They are all references or shared
+	// pointers, so copying them doesn't allocate anything.
 	GRAPHQLSERVICE_EXPORT explicit FieldParams(
 		SelectionSetParams&& selectionSetParams, response::Value&& directives);
 
@@ -190,9 +467,127 @@ struct FieldParams : SelectionSetParams
 	response::Value fieldDirectives;
 };
 
+#ifdef GRAPHQL_USE_COROUTINES
+// FieldResultState is shared between a field accessor coroutine and the FieldResult it returned.
+// The coroutine sets the value or exception when it finishes, and there may be a single
+// continuation waiting to run at that point, e.g. another coroutine which is awaiting the result.
+template <typename T>
+class FieldResultState
+{
+public:
+	void set_value(T&& value)
+	{
+		std::unique_lock lock(_mutex);
+
+		_value = std::make_optional(std::move(value));
+		complete(std::move(lock));
+	}
+
+	void set_exception(std::exception_ptr exception)
+	{
+		std::unique_lock lock(_mutex);
+
+		_exception = std::move(exception);
+		complete(std::move(lock));
+	}
+
+	bool is_ready() const
+	{
+		std::lock_guard lock(_mutex);
+
+		return _ready;
+	}
+
+	// Register a continuation to run on whichever thread finishes the coroutine. If the result is
+	// already available, this returns false and the continuation is not called.
+	bool set_continuation(std::function<void()>&& continuation)
+	{
+		std::lock_guard lock(_mutex);
+
+		if (_ready)
+		{
+			return false;
+		}
+
+		_continuation = std::move(continuation);
+		return true;
+	}
+
+	// Keep shared resources alive until the coroutine which owns this state is destroyed, e.g. the
+	// arguments it references from its frame. If that already happened, they are released right
+	// away.
+	void keep_alive(std::shared_ptr<void>&& resources)
+	{
+		std::lock_guard lock(_mutex);
+
+		if (!_released)
+		{
+			_resources = std::move(resources);
+		}
+	}
+
+	// Called from the coroutine promise when the coroutine frame is destroyed.
+	void release_resources()
+	{
+		std::shared_ptr<void> resources;
+
+		{
+			std::lock_guard lock(_mutex);
+
+			_released = true;
+			resources = std::move(_resources);
+		}
+	}
+
+	// Block the calling thread until the result is available.
+	T get()
+	{
+		std::unique_lock lock(_mutex);
+
+		_readyCondition.wait(lock, [this]() noexcept {
+			return _ready;
+		});
+
+		if (_exception)
+		{
+			std::rethrow_exception(_exception);
+		}
+
+		return std::move(*_value);
+	}
+
+private:
+	void complete(std::unique_lock<std::mutex>&& lock)
+	{
+		auto continuation = std::move(_continuation);
+
+		_ready = true;
+		lock.unlock();
+		_readyCondition.notify_all();
+
+		if (continuation)
+		{
+			continuation();
+		}
+	}
+
+	mutable std::mutex _mutex;
+	std::condition_variable _readyCondition;
+	bool _ready = false;
+	std::optional<T> _value;
+	std::exception_ptr _exception;
+	std::function<void()> _continuation;
+	bool _released = false;
+	std::shared_ptr<void> _resources;
+};
+#endif // GRAPHQL_USE_COROUTINES
+
 // Field accessors may return either a result of T or a std::future<T>, so at runtime the
 // implementer may choose to return by value or defer/parallelize expensive operations by returning
-// an async future.
+// an async future. If GRAPHQL_USE_COROUTINES is defined, field accessors may also be implemented
+// as C++20 coroutines which co_await other results and co_return the value. The resolvers use
+// FieldResult<ResolverResult> the same way, so results which are already available are passed
+// back inline, and only genuinely asynchronous fields allocate the shared state of a future.
 template <typename T>
 class FieldResult
 {
@@ -210,18 +605,181 @@ public:
 			return std::get<std::future<T>>(std::move(_value)).get();
 		}
 
+#ifdef GRAPHQL_USE_COROUTINES
+		if (std::holds_alternative<state_type>(_value))
+		{
+			return std::get<state_type>(_value).state->get();
+		}
+#endif // GRAPHQL_USE_COROUTINES
+
 		return std::get<T>(std::move(_value));
 	}
 
 	bool is_future() const noexcept
 	{
+#ifdef GRAPHQL_USE_COROUTINES
+		if (std::holds_alternative<state_type>(_value))
+		{
+			return true;
+		}
+#endif // GRAPHQL_USE_COROUTINES
+
 		return std::holds_alternative<std::future<T>>(_value);
 	}
 
+#ifdef GRAPHQL_USE_COROUTINES
+	// Wrap the shared state in a distinct type, since T may also be a std::shared_ptr and
+	// FieldResult needs to be implicitly constructible from nullptr.
+	struct state_type
+	{
+		explicit state_type(std::shared_ptr<FieldResultState<T>> stateArg) noexcept
+			: state { std::move(stateArg) }
+		{
+		}
+
+		std::shared_ptr<FieldResultState<T>> state;
+	};
+
+	// Coroutines returning a FieldResult start executing eagerly on the calling thread, and the
+	// FieldResult refers to their shared state once they suspend.
+	struct promise_type
+	{
+		~promise_type()
+		{
+			state->release_resources();
+		}
+
+		FieldResult get_return_object()
+		{
+			return FieldResult { state_type { state } };
+		}
+
+		std::suspend_never initial_suspend() const noexcept
+		{
+			return {};
+		}
+
+		std::suspend_never final_suspend() const noexcept
+		{
+			return {};
+		}
+
+		template <typename U>
+		void return_value(U&& value)
+		{
+			state->set_value(T { std::forward<U>(value) });
+		}
+
+		void unhandled_exception()
+		{
+			state->set_exception(std::current_exception());
+		}
+
+		std::shared_ptr<FieldResultState<T>> state = std::make_shared<FieldResultState<T>>();
+	};
+
+	// Returns false if this is a std::future, which has no way to call a continuation when it's
+	// ready. The only way to wait for one of those is to block a thread.
+	bool is_continuable() const noexcept
+	{
+		return !std::holds_alternative<std::future<T>>(_value);
+	}
+
+	// Keep the resources alive until the coroutine which returned this result finishes.
+	void keep_alive(std::shared_ptr<void>&& resources)
+	{
+		if (std::holds_alternative<state_type>(_value))
+		{
+			std::get<state_type>(_value).state->keep_alive(std::move(resources));
+		}
+	}
+
+	// Returns true if this is the result of a coroutine which has not finished yet.
+	bool is_pending() const
+	{
+		return std::holds_alternative<state_type>(_value)
+			&& !std::get<state_type>(_value).state->is_ready();
+	}
+
+	// Call the continuation once the coroutine result is available instead of blocking a thread
+	// waiting for it. If the result is already available, the continuation runs immediately.
+	void then(std::function<void()>&& continuation)
+	{
+		if (!std::holds_alternative<state_type>(_value)
+			|| !std::get<state_type>(_value).state->set_continuation(std::move(continuation)))
+		{
+			continuation();
+		}
+	}
+
+	// Awaiting a FieldResult suspends the calling coroutine until the result of another coroutine
+	// is available. A std::future<T> has no way to resume a coroutine when it's ready, so awaiting
+	// one will block in await_resume.
+	class awaiter
+	{
+	public:
+		explicit awaiter(FieldResult&& result)
+			: _result { std::move(result) }
+		{
+		}
+
+		bool await_ready() const
+		{
+			return !_result.is_pending();
+		}
+
+		bool await_suspend(std::coroutine_handle<> handle)
+		{
+			return std::get<state_type>(_result._value).state->set_continuation([handle]() {
+				handle.resume();
+			});
+		}
+
+		T await_resume()
+		{
+			return _result.get();
+		}
+
+	private:
+		FieldResult _result;
+	};
+
+	awaiter operator co_await() &&
+	{
+		return awaiter { std::move(*this) };
+	}
+#endif // GRAPHQL_USE_COROUTINES
+
 private:
+#ifdef GRAPHQL_USE_COROUTINES
+	std::variant<T, std::future<T>, state_type> _value;
+#else
 	std::variant<T, std::future<T>> _value;
+#endif // GRAPHQL_USE_COROUTINES
 };
 
+// Call a field accessor from a generated resolver. With GRAPHQL_USE_COROUTINES, the FieldParams
+// and arguments which the accessor takes by reference are moved into a shared frame first, and if
+// the accessor is a coroutine which suspends, they are kept alive until it finishes.
+template <typename ObjectType, typename Accessor, typename... Args>
+auto invokeAccessor(const ObjectType& object, Accessor accessor, Args&&... args)
+{
+#ifdef GRAPHQL_USE_COROUTINES
+	auto frame = std::make_shared<std::tuple<std::decay_t<Args>...>>(std::forward<Args>(args)...);
+	auto result = std::apply(
+		[&object, accessor](auto&... frameArgs) {
+			return (object.*accessor)(std::move(frameArgs)...);
+		},
+		*frame);
+
+	result.keep_alive(std::move(frame));
+
+	return result;
+#else
+	return (object.*accessor)(std::forward<Args>(args)...);
+#endif // GRAPHQL_USE_COROUTINES
+}
+
 // Fragments are referenced by name and have a single type condition (except for inline
 // fragments, where the type condition is common but optional). They contain a set of fields
 // (with optional aliases and sub-selections) and potentially references to other fragments.
@@ -270,14 +828,215 @@ struct ResolverParams : SelectionSetParams
 	const response::Value& variables;
 };
 
+// The results of a selection set or a list which have not been joined yet. When the response is
+// written to a response::Writer, the parent writes each of the results in order and collects their
+// errors, so the response::Value for the whole document is never built.
+class PendingResult
+{
+public:
+	GRAPHQLSERVICE_EXPORT virtual ~PendingResult();
+
+	virtual void write(response::Writer& writer, std::list<schema_error>& errors) = 0;
+};
+
 // Propagate data and errors together without bundling them into a response::Value struct until
-// we're ready to return from the top level Operation.
+// we're ready to return from the top level Operation. If pending is set, it replaces data.
 struct ResolverResult
 {
 	response::Value data;
 	std::list<schema_error> errors;
+	std::unique_ptr<PendingResult> pending {};
 };
 
+// Write the data or the pending results of a ResolverResult, and append all of its errors.
+GRAPHQLSERVICE_EXPORT void writeResult(
+	ResolverResult&& result, response::Writer& writer, std::list<schema_error>& errors);
+
+// Defer joining the elements of a list until the parent writes it to a response::Writer.
+GRAPHQLSERVICE_EXPORT ResolverResult deferList(
+	std::vector<FieldResult<ResolverResult>>&& children, ResolverParams&& params);
+
+// If the list field has an @stream directive, remove the elements after its initialCount from the
+// children and deliver them in later payloads. The path is the error path to the field itself.
+// The streamed elements are resolved after the list has been joined, but each of their ResolverParams
+// shares ownership of its parent field_path, so they can still report errors with the full path.
+GRAPHQLSERVICE_EXPORT void streamList(std::vector<FieldResult<ResolverResult>>& children,
+	const ResolverParams& params, const std::optional<field_path>& path);
+
+#ifdef GRAPHQL_USE_COROUTINES
+// Set the shared state to the value of the result. If the result is still pending, this chains
+// another continuation and keeps the resources alive until it runs, rather than blocking.
+inline void completeResult(const std::shared_ptr<FieldResultState<ResolverResult>>& state,
+	FieldResult<ResolverResult>&& result, std::shared_ptr<void>&& resources = {})
+{
+	if (result.is_pending())
+	{
+		auto pending = std::make_shared<FieldResult<ResolverResult>>(std::move(result));
+
+		pending->then([state, pending, resources = std::move(resources)]() mutable {
+			completeResult(state, std::move(*pending), std::move(resources));
+		});
+
+		return;
+	}
+
+	std::optional<ResolverResult> value;
+
+	try
+	{
+		value = std::make_optional(result.get());
+	}
+	catch (...)
+	{
+		state->set_exception(std::current_exception());
+		return;
+	}
+
+	state->set_value(std::move(*value));
+}
+
+// Call the continuation on whichever thread finishes a pending coroutine result instead of parking
+// another thread to wait for it. The continuation may return another pending result.
+template <typename T, typename Func>
+FieldResult<ResolverResult> continueResult(FieldResult<T>&& result, Func&& func)
+{
+	struct Continuation
+	{
+		FieldResult<T> result;
+		std::decay_t<Func> func;
+		std::shared_ptr<FieldResultState<ResolverResult>> state;
+	};
+
+	auto continuation = std::make_shared<Continuation>(Continuation {
+		std::move(result),
+		std::forward<Func>(func),
+		std::make_shared<FieldResultState<ResolverResult>>(),
+	});
+	FieldResult<ResolverResult> document {
+		typename FieldResult<ResolverResult>::state_type { continuation->state }
+	};
+
+	continuation->result.then([continuation]() {
+		const auto state = continuation->state;
+		std::optional<FieldResult<ResolverResult>> next;
+
+		try
+		{
+			next.emplace(continuation->func(std::move(continuation->result)));
+		}
+		catch (...)
+		{
+			state->set_exception(std::current_exception());
+			return;
+		}
+
+		// The continuation captures the ResolverParams, which the next result may still refer to.
+		completeResult(state, std::move(*next), continuation);
+	});
+
+	return document;
+}
+
+// Join the children on whichever thread finishes the last of their pending coroutine results,
+// instead of parking another thread to wait for all of them.
+template <typename Children, typename Join>
+FieldResult<ResolverResult> joinResults(Children&& children, Join&& join)
+{
+	class JoinState
+	{
+	public:
+		explicit JoinState(Children&& childrenArg, Join&& joinArg)
+			: _children(std::move(childrenArg))
+			, _join(std::forward<Join>(joinArg))
+		{
+		}
+
+		// Count the pending children and register a continuation on each of them.
+		void start(const std::shared_ptr<JoinState>& self)
+		{
+			for (auto& child : _children)
+			{
+				auto& result = childResult(child);
+
+				if (result.is_pending())
+				{
+					++_remaining;
+					result.then([self]() {
+						self->release();
+					});
+				}
+			}
+
+			release();
+		}
+
+		const std::shared_ptr<FieldResultState<ResolverResult>>& state() const noexcept
+		{
+			return _state;
+		}
+
+	private:
+		static FieldResult<ResolverResult>& childResult(FieldResult<ResolverResult>& child)
+		{
+			return child;
+		}
+
+		static FieldResult<ResolverResult>& childResult(
+			std::pair<std::string_view, FieldResult<ResolverResult>>& child)
+		{
+			return child.second;
+		}
+
+		void release()
+		{
+			if (--_remaining > 0)
+			{
+				return;
+			}
+
+			std::optional<FieldResult<ResolverResult>> document;
+
+			try
+			{
+				document.emplace(_join(std::move(_children)));
+			}
+			catch (...)
+			{
+				_state->set_exception(std::current_exception());
+				return;
+			}
+
+			completeResult(_state, std::move(*document));
+		}
+
+		std::decay_t<Children> _children;
+		std::decay_t<Join> _join;
+		std::atomic_size_t _remaining { 1 };
+		const std::shared_ptr<FieldResultState<ResolverResult>> _state =
+			std::make_shared<FieldResultState<ResolverResult>>();
+	};
+
+	auto joinState =
+		std::make_shared<JoinState>(std::forward<Children>(children), std::forward<Join>(join));
+	FieldResult<ResolverResult> document {
+		typename FieldResult<ResolverResult>::state_type { joinState->state() }
+	};
+
+	joinState->start(joinState);
+
+	return document;
+}
+#endif // GRAPHQL_USE_COROUTINES
+
+class Object;
+
+// Generated Object types share a static table of FieldResolver function pointers, so constructing
+// another instance doesn't allocate anything for the resolvers.
+using FieldResolver = FieldResult<ResolverResult> (*)(Object& object, ResolverParams&& params);
+using FieldResolverMap = internal::string_view_map<FieldResolver>;
+
+// Hand-written Object types used to pass a map of std::function resolvers to each instance. The
+// deprecated Object constructor still accepts them and stores them in the Object.
 using Resolver = std::function<std::future<ResolverResult>(ResolverParams&&)>;
 using ResolverMap = internal::string_view_map<Resolver>;
 
@@ -500,6 +1259,14 @@ GRAPHQLSERVICE_EXPORT response::Value ModifiedArgument<response::Value>::convert
 // name and any inheritted interfaces.
 using TypeNames = internal::string_view_set;
 
+// Bind a resolver method on a generated Object type to a FieldResolver entry. The generated
+// resolvers lock the Object::_resolverMutex, so they are not const methods.
+template <class T, FieldResult<ResolverResult> (T::*Resolver)(ResolverParams&&)>
+FieldResult<ResolverResult> dispatchField(Object& object, ResolverParams&& params)
+{
+	return (static_cast<T&>(object).*Resolver)(std::move(params));
+}
+
 // Object parses argument values, performs variable lookups, expands fragments, evaluates @include
 // and @skip directives, and calls through to the resolver functor for each selected field with
 // its arguments. This may be a recursive process for fields which return another complex type,
@@ -507,14 +1274,42 @@ using TypeNames = internal::string_view_set;
 class Object : public std::enable_shared_from_this<Object>
 {
 public:
-	GRAPHQLSERVICE_EXPORT explicit Object(TypeNames&& typeNames, ResolverMap&& resolvers);
+	// The typeNames and resolvers are borrowed, so they must outlive the Object. The generated
+	// types pass in function-local statics which are shared by every instance. If threadSafe is
+	// true, the getField accessors are safe to call concurrently and the resolvers don't lock the
+	// _resolverMutex around them. The generated constructors take the same flag, so each subclass
+	// can opt in separately.
+	GRAPHQLSERVICE_EXPORT explicit Object(const TypeNames& typeNames,
+		const FieldResolverMap& resolvers, bool threadSafe = false) noexcept;
+
+	// Temporaries would be destroyed before the Object which borrows them.
+	explicit Object(TypeNames&& typeNames, const FieldResolverMap& resolvers,
+		bool threadSafe = false) = delete;
+	explicit Object(const TypeNames& typeNames, FieldResolverMap&& resolvers,
+		bool threadSafe = false) = delete;
+	explicit Object(
+		TypeNames&& typeNames, FieldResolverMap&& resolvers, bool threadSafe = false) = delete;
+
+	[[deprecated("Use the Object constructor overload which borrows static TypeNames and a "
+				 "FieldResolverMap instead.")]] GRAPHQLSERVICE_EXPORT explicit Object(TypeNames&&
+																			   typeNames,
+		ResolverMap&& resolvers);
+
 	GRAPHQLSERVICE_EXPORT virtual ~Object() = default;
 
-	GRAPHQLSERVICE_EXPORT std::future<ResolverResult> resolve(
+	GRAPHQLSERVICE_EXPORT FieldResult<ResolverResult> resolve(
 		const SelectionSetParams& selectionSetParams, const peg::ast_node& selection,
+		const FragmentMap& fragments, const response::Value& variables);
+
+	// Callers which resolve a const Object and expect a std::future still compile, but they always
+	// allocate the shared state of a std::future, even if the result is already available.
+	[[deprecated("Use the non-const Object::resolve overload which returns a FieldResult "
+				 "instead.")]] GRAPHQLSERVICE_EXPORT std::future<ResolverResult>
+	resolve(const SelectionSetParams& selectionSetParams, const peg::ast_node& selection,
 		const FragmentMap& fragments, const response::Value& variables) const;
 
 	GRAPHQLSERVICE_EXPORT bool matchesType(std::string_view typeName) const;
+	GRAPHQLSERVICE_EXPORT bool isThreadSafe() const noexcept;
 
 protected:
 	// These callbacks are optional, you may override either, both, or neither of them. The
@@ -526,11 +1321,28 @@ protected:
 	GRAPHQLSERVICE_EXPORT virtual void beginSelectionSet(const SelectionSetParams& params) const;
 	GRAPHQLSERVICE_EXPORT virtual void endSelectionSet(const SelectionSetParams& params) const;
 
+	// The generated resolvers hold this lock while they call the getField accessor. It only owns
+	// the _resolverMutex if the Object is not thread-safe.
+	GRAPHQLSERVICE_EXPORT std::unique_lock<std::mutex> lockResolver();
+
 	std::mutex _resolverMutex {};
 
 private:
-	TypeNames _typeNames;
-	ResolverMap _resolvers;
+	// Storage for the tables passed to the deprecated constructor, which the Object owns instead
+	// of borrowing. Each entry in the FieldResolverMap dispatches to resolveOwnedField.
+	struct OwnedResolvers
+	{
+		TypeNames typeNames;
+		ResolverMap resolvers;
+		FieldResolverMap dispatch;
+	};
+
+	static FieldResult<ResolverResult> resolveOwnedField(Object& object, ResolverParams&& params);
+
+	const std::unique_ptr<OwnedResolvers> _owned;
+	const TypeNames& _typeNames;
+	const FieldResolverMap& _resolvers;
+	const bool _threadSafe;
 };
 
 // Convert the result of a resolver function with chained type modifiers that add nullable or
@@ -565,20 +1377,39 @@ struct ModifiedResult
 	};
 
 	// Convert a single value of the specified type to JSON.
-	static std::future<ResolverResult> convert(
+	static FieldResult<ResolverResult> convert(
 		typename ResultTraits<Type>::future_type result, ResolverParams&& params);
 
 	// Peel off the none modifier. If it's included, it should always be last in the list.
 	template <TypeModifier Modifier = TypeModifier::None, TypeModifier... Other>
 	static typename std::enable_if_t<TypeModifier::None == Modifier && sizeof...(Other) == 0
 			&& !std::is_same_v<Object, Type> && std::is_base_of_v<Object, Type>,
-		std::future<ResolverResult>>
+		FieldResult<ResolverResult>>
 	convert(FieldResult<typename ResultTraits<Type>::type>&& result, ResolverParams&& params)
 	{
 		// Call through to the Object specialization with a static_pointer_cast for subclasses of
 		// Object.
 		static_assert(std::is_same_v<std::shared_ptr<Type>, typename ResultTraits<Type>::type>,
 			"this is the derived object type");
+
+		if (!result.is_future())
+		{
+			return ModifiedResult<Object>::convert(std::static_pointer_cast<Object>(result.get()),
+				std::move(params));
+		}
+
+#ifdef GRAPHQL_USE_COROUTINES
+		if (result.is_continuable())
+		{
+			return continueResult(std::move(result),
+				[wrappedParams = std::move(params)](auto&& objectType) mutable {
+					return ModifiedResult<Object>::convert(
+						std::static_pointer_cast<Object>(objectType.get()),
+						std::move(wrappedParams));
+				});
+		}
+#endif // GRAPHQL_USE_COROUTINES
+
 		auto resultFuture = std::async(
 			std::launch::deferred,
 			[](auto&& objectType) {
@@ -593,7 +1424,7 @@ struct ModifiedResult
 	template <TypeModifier Modifier = TypeModifier::None, TypeModifier... Other>
 	static typename std::enable_if_t<TypeModifier::None == Modifier && sizeof...(Other) == 0
 			&& (std::is_same_v<Object, Type> || !std::is_base_of_v<Object, Type>),
-		std::future<ResolverResult>>
+		FieldResult<ResolverResult>>
 	convert(typename ResultTraits<Type>::future_type result, ResolverParams&& params)
 	{
 		// Just call through to the partial specialization without the modifier.
@@ -604,37 +1435,31 @@ struct ModifiedResult
 	template <TypeModifier Modifier, TypeModifier... Other>
 	static typename std::enable_if_t<TypeModifier::Nullable == Modifier
 			&& std::is_same_v<std::shared_ptr<Type>, typename ResultTraits<Type, Other...>::type>,
-		std::future<ResolverResult>>
+		FieldResult<ResolverResult>>
 	convert(typename ResultTraits<Type, Modifier, Other...>::future_type result,
 		ResolverParams&& params)
 	{
-		return std::async(
-			std::launch::deferred,
-			[](auto&& wrappedFuture, ResolverParams&& wrappedParams) {
-				auto wrappedResult = wrappedFuture.get();
+		auto buildResult = [](auto&& wrappedFuture,
+							   ResolverParams&& wrappedParams) -> FieldResult<ResolverResult> {
+			auto wrappedResult = wrappedFuture.get();
 
-				if (!wrappedResult)
-				{
-					return ResolverResult {};
-				}
-
-				std::promise<typename ResultTraits<Type, Other...>::type> promise;
+			if (!wrappedResult)
+			{
+				return ResolverResult {};
+			}
 
-				promise.set_value(std::move(wrappedResult));
+			return ModifiedResult::convert<Other...>(std::move(wrappedResult),
+				std::move(wrappedParams));
+		};
 
-				return ModifiedResult::convert<Other...>(promise.get_future(),
-					std::move(wrappedParams))
-					.get();
-			},
-			std::move(result),
-			std::move(params));
+		return resolveNullable(std::move(result), std::move(params), std::move(buildResult));
 	}
 
 	// Peel off nullable modifiers for anything else, which should all be std::optional.
 	template <TypeModifier Modifier, TypeModifier... Other>
 	static typename std::enable_if_t<TypeModifier::Nullable == Modifier
 			&& !std::is_same_v<std::shared_ptr<Type>, typename ResultTraits<Type, Other...>::type>,
-		std::future<ResolverResult>>
+		FieldResult<ResolverResult>>
 	convert(typename ResultTraits<Type, Modifier, Other...>::future_type result,
 		ResolverParams&& params)
 	{
@@ -642,124 +1467,239 @@ struct ModifiedResult
 						  typename ResultTraits<Type, Modifier, Other...>::type>,
 			"this is the optional version");
 
-		return std::async(
-			std::launch::deferred,
-			[](auto&& wrappedFuture, ResolverParams&& wrappedParams) {
-				auto wrappedResult = wrappedFuture.get();
-
-				if (!wrappedResult)
-				{
-					return ResolverResult {};
-				}
+		auto buildResult = [](auto&& wrappedFuture,
+							   ResolverParams&& wrappedParams) -> FieldResult<ResolverResult> {
+			auto wrappedResult = wrappedFuture.get();
 
-				std::promise<typename ResultTraits<Type, Other...>::type> promise;
+			if (!wrappedResult)
+			{
+				return ResolverResult {};
+			}
 
-				promise.set_value(std::move(*wrappedResult));
+			return ModifiedResult::convert<Other...>(std::move(*wrappedResult),
+				std::move(wrappedParams));
+		};
 
-				return ModifiedResult::convert<Other...>(promise.get_future(),
-					std::move(wrappedParams))
-					.get();
-			},
-			std::move(result),
-			std::move(params));
+		return resolveNullable(std::move(result), std::move(params), std::move(buildResult));
 	}
 
 	// Peel off list modifiers.
 	template <TypeModifier Modifier, TypeModifier... Other>
-	static typename std::enable_if_t<TypeModifier::List == Modifier, std::future<ResolverResult>>
+	static typename std::enable_if_t<TypeModifier::List == Modifier, FieldResult<ResolverResult>>
 	convert(typename ResultTraits<Type, Modifier, Other...>::future_type result,
 		ResolverParams&& params)
 	{
+		if (result.is_future())
+		{
+#ifdef GRAPHQL_USE_COROUTINES
+			if (result.is_continuable())
+			{
+				return continueResult(std::move(result),
+					[wrappedParams = std::move(params)](auto&& wrappedResult) mutable {
+						auto children = convertList<Other...>(wrappedResult.get(), wrappedParams);
+
+						return joinChildren(std::move(children), std::move(wrappedParams));
+					});
+			}
+#endif // GRAPHQL_USE_COROUTINES
+
+			const auto launch = params.launch;
+			const auto executor = params.executor;
+
+			return launchAsync(
+				executor,
+				launch,
+				[](auto&& wrappedFuture, ResolverParams&& wrappedParams) {
+					auto children = convertList<Other...>(wrappedFuture.get(), wrappedParams);
+
+					return joinList(std::move(children), std::move(wrappedParams));
+				},
+				std::move(result),
+				std::move(params));
+		}
+
+		auto children = convertList<Other...>(result.get(), params);
+
+		return joinChildren(std::move(children), std::move(params));
+	}
+
+private:
+	using ResolverCallback =
+		std::function<response::Value(typename ResultTraits<Type>::type&&, const ResolverParams&)>;
+
+	// If the nullable result is already available, build the result of the wrapped type inline,
+	// otherwise defer it until the result is ready.
+	template <typename ResultType, typename BuildResult>
+	static FieldResult<ResolverResult> resolveNullable(
+		FieldResult<ResultType>&& result, ResolverParams&& params, BuildResult&& buildResult)
+	{
+		if (!result.is_future())
+		{
+			return buildResult(std::move(result), std::move(params));
+		}
+
+#ifdef GRAPHQL_USE_COROUTINES
+		if (result.is_continuable())
+		{
+			return continueResult(std::move(result),
+				[wrappedParams = std::move(params),
+					wrappedBuildResult = std::forward<BuildResult>(buildResult)](
+					auto&& wrappedResult) mutable {
+					return wrappedBuildResult(std::move(wrappedResult), std::move(wrappedParams));
+				});
+		}
+#endif // GRAPHQL_USE_COROUTINES
+
 		return std::async(
-			params.launch,
-			[](auto&& wrappedFuture, ResolverParams&& wrappedParams) {
-				auto wrappedResult = wrappedFuture.get();
-				std::vector<std::future<ResolverResult>> children;
-				const auto parentPath = wrappedParams.errorPath;
+			std::launch::deferred,
+			[](auto&& wrappedFuture, ResolverParams&& wrappedParams, auto&& wrappedBuildResult) {
+				return wrappedBuildResult(std::move(wrappedFuture), std::move(wrappedParams)).get();
+			},
+			std::move(result),
+			std::move(params),
+			std::forward<BuildResult>(buildResult));
+	}
+
+	// Convert each of the elements in a list without waiting for any of their results.
+	template <TypeModifier... Other>
+	static std::vector<FieldResult<ResolverResult>> convertList(
+		typename ResultTraits<Type, TypeModifier::List, Other...>::type&& wrappedResult,
+		ResolverParams& wrappedParams)
+	{
+		std::vector<FieldResult<ResolverResult>> children;
+		const auto parentPath = wrappedParams.errorPath;
+
+		children.reserve(wrappedResult.size());
+		wrappedParams.errorPath = std::make_optional(
+			field_path { parentPath ? std::make_shared<const field_path>(*parentPath) : nullptr,
+				path_segment { size_t { 0 } } });
+
+		using vector_type = std::decay_t<decltype(wrappedResult)>;
+
+		// Dispatch the keys which the elements queued in any DataLoader after converting all of
+		// them, so they're loaded in a single batch.
+		BatchScope batchScope { wrappedParams.state };
+
+		if constexpr (!std::is_same_v<std::decay_t<typename vector_type::reference>,
+						  typename vector_type::value_type>)
+		{
+			// Special handling for std::vector<> specializations which don't return a
+			// reference to the underlying type, i.e. std::vector<bool> on many platforms.
+			// Copy the values from the std::vector<> rather than moving them.
+			for (typename vector_type::value_type entry : wrappedResult)
+			{
+				children.push_back(ModifiedResult::convert<Other...>(std::move(entry),
+					ResolverParams(wrappedParams)));
+				++std::get<size_t>(wrappedParams.errorPath->segment);
+			}
+		}
+		else
+		{
+			for (auto& entry : wrappedResult)
+			{
+				children.push_back(ModifiedResult::convert<Other...>(std::move(entry),
+					ResolverParams(wrappedParams)));
+				++std::get<size_t>(wrappedParams.errorPath->segment);
+			}
+		}
+
+		streamList(children, wrappedParams, parentPath);
 
-				children.reserve(wrappedResult.size());
-				wrappedParams.errorPath = std::make_optional(field_path {
-					parentPath ? std::make_optional(std::cref(*parentPath)) : std::nullopt,
-					path_segment { size_t { 0 } } });
+		return children;
+	}
 
-				using vector_type = std::decay_t<decltype(wrappedFuture.get())>;
+	// Join the elements of a list inline if they're all available. Otherwise wait for them in
+	// another task, or with coroutines, on whichever thread finishes the last of them.
+	static FieldResult<ResolverResult> joinChildren(
+		std::vector<FieldResult<ResolverResult>>&& children, ResolverParams&& params)
+	{
+		// A streaming list waits for its elements when it's written, so it doesn't need to launch
+		// another task to join them.
+		if (params.streaming
+			|| std::none_of(children.cbegin(), children.cend(), [](const auto& child) noexcept {
+				   return child.is_future();
+			   }))
+		{
+			return joinList(std::move(children), std::move(params));
+		}
+
+#ifdef GRAPHQL_USE_COROUTINES
+		if (std::all_of(children.cbegin(), children.cend(), [](const auto& child) noexcept {
+				return child.is_continuable();
+			}))
+		{
+			return joinResults(std::move(children),
+				[wrappedParams = std::move(params)](auto&& readyChildren) mutable {
+					return joinList(std::move(readyChildren), std::move(wrappedParams));
+				});
+		}
+#endif // GRAPHQL_USE_COROUTINES
 
-				if constexpr (!std::is_same_v<std::decay_t<typename vector_type::reference>,
-								  typename vector_type::value_type>)
+		const auto launch = params.launch;
+		const auto executor = params.executor;
+
+		return launchAsync(executor,
+			launch,
+			&ModifiedResult::joinList,
+			std::move(children),
+			std::move(params));
+	}
+
+	// Wait for the results of each of the elements in a list and join them in a single result.
+	static ResolverResult joinList(
+		std::vector<FieldResult<ResolverResult>>&& children, ResolverParams&& wrappedParams)
+	{
+		if (wrappedParams.streaming)
+		{
+			return deferList(std::move(children), std::move(wrappedParams));
+		}
+
+		ResolverResult document { response::Value { response::Type::List } };
+
+		document.data.reserve(children.size());
+		std::get<size_t>(wrappedParams.errorPath->segment) = 0;
+
+		for (auto& child : children)
+		{
+			try
+			{
+				auto value = child.get();
+
+				document.data.emplace_back(std::move(value.data));
+
+				if (!value.errors.empty())
 				{
-					// Special handling for std::vector<> specializations which don't return a
-					// reference to the underlying type, i.e. std::vector<bool> on many platforms.
-					// Copy the values from the std::vector<> rather than moving them.
-					for (typename vector_type::value_type entry : wrappedResult)
-					{
-						children.push_back(ModifiedResult::convert<Other...>(std::move(entry),
-							ResolverParams(wrappedParams)));
-						++std::get<size_t>(wrappedParams.errorPath->segment);
-					}
+					document.errors.splice(document.errors.end(), value.errors);
 				}
-				else
+			}
+			catch (schema_exception& scx)
+			{
+				auto errors = scx.getStructuredErrors();
+
+				if (!errors.empty())
 				{
-					for (auto& entry : wrappedResult)
-					{
-						children.push_back(ModifiedResult::convert<Other...>(std::move(entry),
-							ResolverParams(wrappedParams)));
-						++std::get<size_t>(wrappedParams.errorPath->segment);
-					}
+					document.errors.splice(document.errors.end(), errors);
 				}
+			}
+			catch (const std::exception& ex)
+			{
+				std::ostringstream message;
 
-				ResolverResult document { response::Value { response::Type::List } };
+				message << "Field error name: " << wrappedParams.fieldName
+						<< " unknown error: " << ex.what();
 
-				document.data.reserve(children.size());
-				std::get<size_t>(wrappedParams.errorPath->segment) = 0;
+				document.errors.emplace_back(schema_error { message.str(),
+					wrappedParams.getLocation(),
+					buildErrorPath(wrappedParams.errorPath) });
+			}
 
-				for (auto& child : children)
-				{
-					try
-					{
-						auto value = child.get();
-
-						document.data.emplace_back(std::move(value.data));
-
-						if (!value.errors.empty())
-						{
-							document.errors.splice(document.errors.end(), value.errors);
-						}
-					}
-					catch (schema_exception& scx)
-					{
-						auto errors = scx.getStructuredErrors();
-
-						if (!errors.empty())
-						{
-							document.errors.splice(document.errors.end(), errors);
-						}
-					}
-					catch (const std::exception& ex)
-					{
-						std::ostringstream message;
-
-						message << "Field error name: " << wrappedParams.fieldName
-								<< " unknown error: " << ex.what();
-
-						document.errors.emplace_back(schema_error { message.str(),
-							wrappedParams.getLocation(),
-							buildErrorPath(wrappedParams.errorPath) });
-					}
-
-					++std::get<size_t>(wrappedParams.errorPath->segment);
-				}
+			++std::get<size_t>(wrappedParams.errorPath->segment);
+		}
 
-				return document;
-			},
-			std::move(result),
-			std::move(params));
+		return document;
 	}
 
-private:
-	using ResolverCallback =
-		std::function<response::Value(typename ResultTraits<Type>::type&&, const ResolverParams&)>;
-
-	static std::future<ResolverResult> resolve(typename ResultTraits<Type>::future_type result,
+	static FieldResult<ResolverResult> resolve(typename ResultTraits<Type>::future_type result,
 		ResolverParams&& params, ResolverCallback&& resolver)
 	{
 		static_assert(!std::is_base_of_v<Object, Type>,
@@ -798,6 +1738,22 @@ private:
 			return document;
 		};
 
+#ifdef GRAPHQL_USE_COROUTINES
+		if (result.is_pending())
+		{
+			// Build the result on whichever thread finishes the coroutine, rather than parking
+			// another thread to wait for it.
+			return continueResult(std::move(result),
+				[buildResult,
+					wrappedParams = std::move(params),
+					wrappedResolver = std::move(resolver)](auto&& wrappedResult) mutable {
+					return buildResult(std::move(wrappedResult),
+						std::move(wrappedParams),
+						std::move(wrappedResolver));
+				});
+		}
+#endif // GRAPHQL_USE_COROUTINES
+
 		if (result.is_future())
 		{
 			return std::async(std::launch::deferred,
@@ -807,11 +1763,7 @@ private:
 				std::move(resolver));
 		}
 
-		std::promise<ResolverResult> promise;
-
-		promise.set_value(buildResult(std::move(result), std::move(params), std::move(resolver)));
-
-		return promise.get_future();
+		return buildResult(std::move(result), std::move(params), std::move(resolver));
 	}
 };
 
@@ -829,25 +1781,25 @@ using ObjectResult = ModifiedResult<Object>;
 #ifdef GRAPHQL_DLLEXPORTS
 // Export all of the built-in converters
 template <>
-GRAPHQLSERVICE_EXPORT std::future<ResolverResult> ModifiedResult<response::IntType>::convert(
+GRAPHQLSERVICE_EXPORT FieldResult<ResolverResult> ModifiedResult<response::IntType>::convert(
 	FieldResult<response::IntType>&& result, ResolverParams&& params);
 template <>
-GRAPHQLSERVICE_EXPORT std::future<ResolverResult> ModifiedResult<response::FloatType>::convert(
+GRAPHQLSERVICE_EXPORT FieldResult<ResolverResult> ModifiedResult<response::FloatType>::convert(
 	FieldResult<response::FloatType>&& result, ResolverParams&& params);
 template <>
-GRAPHQLSERVICE_EXPORT std::future<ResolverResult> ModifiedResult<response::StringType>::convert(
+GRAPHQLSERVICE_EXPORT FieldResult<ResolverResult> ModifiedResult<response::StringType>::convert(
 	FieldResult<response::StringType>&& result, ResolverParams&& params);
 template <>
-GRAPHQLSERVICE_EXPORT std::future<ResolverResult> ModifiedResult<response::BooleanType>::convert(
+GRAPHQLSERVICE_EXPORT FieldResult<ResolverResult> ModifiedResult<response::BooleanType>::convert(
 	FieldResult<response::BooleanType>&& result, ResolverParams&& params);
 template <>
-GRAPHQLSERVICE_EXPORT std::future<ResolverResult> ModifiedResult<response::IdType>::convert(
+GRAPHQLSERVICE_EXPORT FieldResult<ResolverResult> ModifiedResult<response::IdType>::convert(
 	FieldResult<response::IdType>&& result, ResolverParams&& params);
 template <>
-GRAPHQLSERVICE_EXPORT std::future<ResolverResult> ModifiedResult<response::Value>::convert(
+GRAPHQLSERVICE_EXPORT FieldResult<ResolverResult> ModifiedResult<response::Value>::convert(
 	FieldResult<response::Value>&& result, ResolverParams&& params);
 template <>
-GRAPHQLSERVICE_EXPORT std::future<ResolverResult> ModifiedResult<Object>::convert(
+GRAPHQLSERVICE_EXPORT FieldResult<ResolverResult> ModifiedResult<Object>::convert(
 	FieldResult<std::shared_ptr<Object>>&& result, ResolverParams&& params);
 #endif // GRAPHQL_DLLEXPORTS
 
@@ -867,7 +1819,8 @@ struct SubscriptionParams
 // State which is captured and kept alive until all pending futures have been resolved for an
 // operation. Note: SelectionSet is the other parameter that gets passed to the top level Object,
 // it's a borrowed reference to an element in the AST. In the case of query and mutation operations,
-// it's up to the caller to guarantee the lifetime of the AST exceeds the futures we return.
+// the task which resolves the operation holds a copy of the peg::ast, which shares ownership of the
+// AST until the futures we return have been resolved, even if the caller releases its own copy.
 // Subscription operations need to hold onto the queries in SubscriptionData, so the lifetime is
 // already tied to the registration and any pending futures passed to callbacks.
 struct OperationData : std::enable_shared_from_this<OperationData>
@@ -884,6 +1837,11 @@ struct OperationData : std::enable_shared_from_this<OperationData>
 // Subscription callbacks receive the response::Value representing the result of evaluating the
 // SelectionSet against the payload.
 using SubscriptionCallback = std::function<void(std::future<response::Value>)>;
+
+// Incremental callbacks receive the initial result of an operation with @defer or @stream, followed
+// by a payload for each deferred fragment or streamed list element. Each of them has a hasNext
+// member, which is false on the last one.
+using IncrementalCallback = std::function<void(response::Value&&)>;
 using SubscriptionArguments = std::map<std::string_view, response::Value>;
 using SubscriptionFilterCallback = std::function<bool(response::MapType::const_reference)>;
 
@@ -910,8 +1868,8 @@ struct SubscriptionData : std::enable_shared_from_this<SubscriptionData>
 	const peg::ast_node& selection;
 };
 
-// Forward declare just the class type so we can reference it in the Request::_validation member.
-class ValidateExecutableVisitor;
+// Forward declare just the struct type so we can reference it in the Request::_validation member.
+struct ValidationContext;
 
 // Request scans the fragment definitions and finds the right operation definition to interpret
 // depending on the operation name (which might be empty for a single-operation document). It
@@ -935,6 +1893,27 @@ public:
 	GRAPHQLSERVICE_EXPORT std::future<response::Value> resolve(std::launch launch,
 		const std::shared_ptr<RequestState>& state, peg::ast& query,
 		const std::string& operationName, response::Value&& variables) const;
+	GRAPHQLSERVICE_EXPORT std::future<response::Value> resolve(
+		const std::shared_ptr<Executor>& executor, const std::shared_ptr<RequestState>& state,
+		peg::ast& query, const std::string& operationName, response::Value&& variables) const;
+
+	GRAPHQLSERVICE_EXPORT std::future<void> resolve(std::launch launch,
+		const std::shared_ptr<RequestState>& state, peg::ast& query,
+		const std::string& operationName, response::Value&& variables,
+		response::Writer& writer) const;
+	GRAPHQLSERVICE_EXPORT std::future<void> resolve(const std::shared_ptr<Executor>& executor,
+		const std::shared_ptr<RequestState>& state, peg::ast& query,
+		const std::string& operationName, response::Value&& variables,
+		response::Writer& writer) const;
+
+	GRAPHQLSERVICE_EXPORT std::future<void> resolve(std::launch launch,
+		const std::shared_ptr<RequestState>& state, peg::ast& query,
+		const std::string& operationName, response::Value&& variables,
+		IncrementalCallback&& callback) const;
+	GRAPHQLSERVICE_EXPORT std::future<void> resolve(const std::shared_ptr<Executor>& executor,
+		const std::shared_ptr<RequestState>& state, peg::ast& query,
+		const std::string& operationName, response::Value&& variables,
+		IncrementalCallback&& callback) const;
 
 	GRAPHQLSERVICE_EXPORT SubscriptionKey subscribe(
 		SubscriptionParams&& params, SubscriptionCallback&& callback);
@@ -992,6 +1971,22 @@ public:
 		response::Value&& variables) const;
 
 private:
+	std::future<response::Value> resolve(std::launch launch,
+		const std::shared_ptr<Executor>& executor, const std::shared_ptr<RequestState>& state,
+		peg::ast& query, const std::string& operationName, response::Value&& variables) const;
+	std::future<void> resolve(std::launch launch, const std::shared_ptr<Executor>& executor,
+		const std::shared_ptr<RequestState>& state, peg::ast& query,
+		const std::string& operationName, response::Value&& variables,
+		response::Writer& writer) const;
+	std::future<void> resolve(std::launch launch, const std::shared_ptr<Executor>& executor,
+		const std::shared_ptr<RequestState>& state, peg::ast& query,
+		const std::string& operationName, response::Value&& variables,
+		IncrementalCallback&& callback) const;
+	std::future<ResolverResult> resolveOperation(std::launch launch,
+		const std::shared_ptr<Executor>& executor, const std::shared_ptr<RequestState>& state,
+		peg::ast& query, const std::string& operationName, response::Value&& variables,
+		response::Writer* writer, IncrementalCallback&& callback) const;
+
 	std::pair<std::string, const peg::ast_node*> findUnvalidatedOperationDefinition(
 		const peg::ast_node& root, const std::string& operationName) const;
 
@@ -1000,7 +1995,7 @@ private:
 		const std::string& operationName, response::Value&& variables) const;
 
 	const TypeMap _operations;
-	std::unique_ptr<ValidateExecutableVisitor> _validation;
+	std::unique_ptr<const ValidationContext> _validation;
 	internal::sorted_map<SubscriptionKey, std::shared_ptr<SubscriptionData>> _subscriptions;
 	internal::string_view_map<internal::sorted_set<SubscriptionKey>> _listeners;
 	SubscriptionKey _nextKey = 0;
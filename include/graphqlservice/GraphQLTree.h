@@ -13,6 +13,10 @@
 #include <tao/pegtl.hpp>
 #include <tao/pegtl/contrib/parse_tree.hpp>
 
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -23,12 +27,244 @@ namespace graphql::peg {
 using namespace tao::graphqlpeg;
 namespace peginternal = tao::graphqlpeg::internal;
 
+// Monotonic arena which owns all of the nodes in a single parsed document. While the parser is
+// running with an arena in scope on the current thread, the nodes and their children are allocated
+// in the arena instead of the heap. They are never freed individually, the arena releases all of
+// them at once when it is destroyed, without destroying each of the nodes in the tree.
+class ast_arena
+{
+public:
+	GRAPHQLPEG_EXPORT ast_arena() noexcept;
+	GRAPHQLPEG_EXPORT ~ast_arena();
+
+	ast_arena(const ast_arena&) = delete;
+	ast_arena(ast_arena&&) = delete;
+	ast_arena& operator=(const ast_arena&) = delete;
+	ast_arena& operator=(ast_arena&&) = delete;
+
+	// Make the arena current on this thread until the scope is destroyed.
+	class scope
+	{
+	public:
+		GRAPHQLPEG_EXPORT explicit scope(ast_arena& arena) noexcept;
+		GRAPHQLPEG_EXPORT ~scope();
+
+		scope(const scope&) = delete;
+		scope(scope&&) = delete;
+		scope& operator=(const scope&) = delete;
+		scope& operator=(scope&&) = delete;
+
+	private:
+		ast_arena* const _previous;
+	};
+
+	// Returns the arena in scope on this thread, or nullptr if nodes should use the heap.
+	[[nodiscard]] GRAPHQLPEG_EXPORT static ast_arena* current() noexcept;
+
+	// This is not synchronized, it should only be called by the parser while the arena is current.
+	[[nodiscard]] GRAPHQLPEG_EXPORT void* allocate(size_t size, size_t alignment);
+
+	// Allocate space for a string in the arena. This may be called from multiple threads after
+	// parsing, e.g. to cache the unescaped value of a string node.
+	[[nodiscard]] GRAPHQLPEG_EXPORT char* allocate_string(size_t size);
+
+private:
+	static constexpr size_t s_initialBlockSize = 4096;
+	static constexpr size_t s_maxBlockSize = 64 * 1024;
+
+	std::mutex _stringMutex;
+	std::vector<std::unique_ptr<char[]>> _blocks;
+	size_t _nextBlockSize = s_initialBlockSize;
+	char* _next = nullptr;
+	size_t _remaining = 0;
+};
+
+// Allocate the children of a node in the same ast_arena as the node, or on the heap if the node
+// was created outside of the parser.
+template <typename T>
+class ast_allocator
+{
+public:
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+	ast_allocator() noexcept
+		: _arena { ast_arena::current() }
+	{
+	}
+
+	template <typename U>
+	ast_allocator(const ast_allocator<U>& other) noexcept
+		: _arena { other.arena() }
+	{
+	}
+
+	[[nodiscard]] T* allocate(size_t count)
+	{
+		if (_arena)
+		{
+			return static_cast<T*>(_arena->allocate(count * sizeof(T), alignof(T)));
+		}
+
+		return std::allocator<T>().allocate(count);
+	}
+
+	void deallocate(T* ptr, size_t count) noexcept
+	{
+		// Memory in the arena is only released when the whole arena is destroyed.
+		if (!_arena)
+		{
+			std::allocator<T>().deallocate(ptr, count);
+		}
+	}
+
+	[[nodiscard]] ast_arena* arena() const noexcept
+	{
+		return _arena;
+	}
+
+	template <typename U>
+	[[nodiscard]] bool operator==(const ast_allocator<U>& rhs) const noexcept
+	{
+		return _arena == rhs.arena();
+	}
+
+	template <typename U>
+	[[nodiscard]] bool operator!=(const ast_allocator<U>& rhs) const noexcept
+	{
+		return _arena != rhs.arena();
+	}
+
+private:
+	ast_arena* _arena;
+};
+
+// Index of the line starts in a parsed document. The parser only records where each ast_node begins,
+// and the line and column are computed on demand from the byte offset, e.g. when reporting an
+// error. The index is built the first time a position is requested, and it's safe to request
+// positions from multiple threads at the same time.
+class ast_line_index
+{
+public:
+	ast_line_index() = default;
+
+	ast_line_index(const ast_line_index&) = delete;
+	ast_line_index& operator=(const ast_line_index&) = delete;
+
+	// Set the range of the input, before parsing it.
+	GRAPHQLPEG_EXPORT void reset(const char* begin, const char* end, std::string_view source);
+
+	[[nodiscard]] GRAPHQLPEG_EXPORT position find(const char* data) const;
+
+private:
+	const char* _begin = nullptr;
+	const char* _end = nullptr;
+	std::string _source;
+
+	mutable std::once_flag _lineStartsOnce;
+	mutable std::vector<size_t> _lineStarts;
+};
+
+// Compact IDs for each of the grammar rules which the parser may select as an ast_node. Type checks
+// only compare these IDs, so they work the same way in every module, even if the parse tree was
+// constructed in another shared library. Since they're part of the ABI, new rules should only be
+// appended to the end of the list.
+enum class ast_rule : uint8_t
+{
+	none,
+
+	operation_type,
+	list_value,
+	object_field_name,
+	object_field,
+	object_value,
+	variable_value,
+	integer_value,
+	float_value,
+	escaped_unicode,
+	escaped_char,
+	string_quote_character,
+	block_escape_sequence,
+	block_quote_character,
+	string_value,
+	true_keyword,
+	false_keyword,
+	null_keyword,
+	enum_value,
+	field_name,
+	argument_name,
+	argument,
+	arguments,
+	directive_name,
+	directive,
+	directives,
+	variable,
+	scalar_name,
+	named_type,
+	list_type,
+	nonnull_type,
+	default_value,
+	operation_definition,
+	fragment_definition,
+	schema_definition,
+	scalar_type_definition,
+	object_type_definition,
+	interface_type_definition,
+	union_type_definition,
+	enum_type_definition,
+	input_object_type_definition,
+	directive_definition,
+	schema_extension,
+	scalar_type_extension,
+	object_type_extension,
+	interface_type_extension,
+	union_type_extension,
+	enum_type_extension,
+	input_object_type_extension,
+	description,
+	object_name,
+	interface_name,
+	union_name,
+	enum_name,
+	root_operation_definition,
+	interface_type,
+	input_field_definition,
+	input_fields_definition,
+	arguments_definition,
+	field_definition,
+	fields_definition,
+	union_type,
+	enum_value_definition,
+	directive_location,
+	operation_type_definition,
+	variable_name,
+	alias_name,
+	alias,
+	operation_name,
+	fragment_name,
+	field,
+	fragment_spread,
+	inline_fragment,
+	selection_set,
+	type_condition,
+};
+
+// The ID for each selected Rule is specialized in GraphQLGrammar.h, anything else is ast_rule::none.
+template <typename Rule>
+inline constexpr ast_rule ast_rule_id = ast_rule::none;
+
 class ast_node
 {
 public:
 	// Must be default constructible
 	ast_node() = default;
 
+	// Nodes created by the parser are allocated in the current ast_arena, if there is one.
+	[[nodiscard]] GRAPHQLPEG_EXPORT static void* operator new(size_t size);
+	GRAPHQLPEG_EXPORT static void operator delete(void* ptr) noexcept;
+
 	// Nodes are always owned/handled by a std::unique_ptr
 	// and never copied or assigned...
 	ast_node(const ast_node&) = delete;
@@ -45,47 +281,54 @@ public:
 	[[nodiscard]] GRAPHQLPEG_EXPORT std::string string() const noexcept;
 	[[nodiscard]] GRAPHQLPEG_EXPORT bool has_content() const noexcept;
 
+	// This is not synchronized, it should only be called by the parser for escape sequences.
 	GRAPHQLPEG_EXPORT void unescaped_view(std::string_view unescaped) noexcept;
+
+	// The unescaped value is computed and cached the first time it's requested, and it's safe to
+	// request it from multiple threads at the same time, e.g. when validating a shared document.
 	[[nodiscard]] GRAPHQLPEG_EXPORT std::string_view unescaped_view() const;
 
+	// Unescape the value directly into a new string, without caching it in the node. If the parser
+	// already set the unescaped_view(), this just copies it.
+	[[nodiscard]] GRAPHQLPEG_EXPORT std::string unescaped() const;
+
 	template <typename U>
 	[[nodiscard]] bool is_type() const noexcept
 	{
-		const auto u = type_name<U>();
+		// Rules which are never selected don't have an ID, so they never match any node.
+		return ast_rule_id<U> != ast_rule::none && _rule == ast_rule_id<U>;
+	}
 
-		// The pointer comparison doesn't work with shared libraries where the parse tree is
-		// constructed in one module and consumed in another. So to optimize this comparison, check
-		// the size first, then the hash (cached in a static local variable per specialization of
-		// type_hash<U>()), then the pointer comparison with a full string compare as fallback.
-		return _type.size() == u.size() && _type_hash == type_hash<U>()
-			&& (_type.data() == u.data() || _type == u);
+	[[nodiscard]] ast_rule rule() const noexcept
+	{
+		return _rule;
 	}
 
 	template <typename... States>
 	void remove_content(States&&...) noexcept
 	{
-		_content = {};
+		_content = { _content.data(), 0 };
 		_unescaped.reset();
 	}
 
 	// All non-root nodes receive a call to start() when
 	// a match is attempted for Rule in a parsing run...
 	template <typename Rule, typename ParseInput, typename... States>
-	void start(const ParseInput& in, States&&...)
+	void start(const ParseInput& in, const ast_line_index& lines, States&&...)
 	{
-		_begin = in.iterator();
+		_lines = &lines;
+		_content = { in.current(), 0 };
 	}
 
 	// ...and later a call to success() when the match succeeded...
 	template <typename Rule, typename ParseInput, typename... States>
 	void success(const ParseInput& in, States&&...)
 	{
-		const char* end = in.iterator().data;
+		const char* begin = _content.data();
+		const char* end = in.current();
 
-		_type = type_name<Rule>();
-		_type_hash = type_hash<Rule>();
-		_source = in.source();
-		_content = { _begin.data, static_cast<size_t>(end - _begin.data) };
+		_rule = ast_rule_id<Rule>;
+		_content = { begin, static_cast<size_t>(end - begin) };
 		_unescaped.reset();
 	}
 
@@ -110,45 +353,43 @@ public:
 		children.emplace_back(std::move(child));
 	}
 
-	using children_t = std::vector<std::unique_ptr<ast_node>>;
+	using children_t =
+		std::vector<std::unique_ptr<ast_node>, ast_allocator<std::unique_ptr<ast_node>>>;
 
 	children_t children;
 
 private:
-	template <typename U>
-	[[nodiscard]] static std::string_view type_name() noexcept
-	{
-		// This is cached in a static local variable per-specialization, but each module may have
-		// its own instance of the specialization and the local variable.
-		static const std::string_view name { tao::graphqlpeg::demangle<U>() };
-
-		return name;
-	}
-
-	template <typename U>
-	[[nodiscard]] static size_t type_hash() noexcept
-	{
-		// This is cached in a static local variable per-specialization, but each module may have
-		// its own instance of the specialization and the local variable.
-		static const size_t hash = std::hash<std::string_view>()(type_name<U>());
-
-		return hash;
-	}
-
-	std::string_view _source;
-	peginternal::iterator _begin;
-	std::string_view _type;
-	size_t _type_hash = 0;
+	// The content starts where the node begins, and the line index computes the position from that.
+	const ast_line_index* _lines = nullptr;
+	ast_rule _rule = ast_rule::none;
 	std::string_view _content;
 
-	using unescaped_t = std::variant<std::string_view, std::string>;
+	// The parser sets _unescaped for escape sequences, and it never changes after parsing. Anything
+	// else is cached in _unescapedCache the first time it's requested, guarded by _unescapedOnce. If
+	// a string only has one child without any escape sequences, it's a view of the source. Otherwise
+	// it's unescaped directly into the ast_arena for the node, or into _unescapedCopy if the node was
+	// allocated on the heap. Neither of the helpers reads the lazy cache, so they don't race with it.
+	[[nodiscard]] size_t unescaped_capacity() const noexcept;
+	char* write_unescaped(char* output) const noexcept;
+
+	std::optional<std::string_view> _unescaped;
 
-	std::unique_ptr<unescaped_t> _unescaped;
+	mutable std::once_flag _unescapedOnce;
+	mutable std::string_view _unescapedCache;
+	mutable std::unique_ptr<std::string> _unescapedCopy;
 };
 
+// The input data for a parsed document and the ast_arena which owns all of its nodes. The root
+// ast_node shares ownership of the ast_input, so they are kept alive and released together.
 struct ast_input
 {
-	std::variant<std::vector<char>, std::unique_ptr<file_input<>>, std::string_view> data;
+	// PEGTL implements file_input with mmap_input wherever memory mapped files are available, so
+	// documents parsed with parseFile or parseSchemaFile reference the mapping without a copy.
+	std::variant<std::vector<char>, std::string,
+		std::unique_ptr<file_input<tracking_mode::lazy>>, std::string_view>
+		data;
+	ast_line_index lines;
+	ast_arena arena;
 };
 
 } // namespace graphql::peg
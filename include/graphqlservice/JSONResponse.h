@@ -20,10 +20,93 @@
 
 #include "graphqlservice/GraphQLResponse.h"
 
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string_view>
+
 namespace graphql::response {
 
 JSONRESPONSE_EXPORT std::string toJSON(Value&& response);
 
+// A JSONSink receives the output of writeJSON in chunks, in order. The chunk is only valid until
+// write returns, so the sink needs to copy anything it wants to keep.
+class JSONSink
+{
+public:
+	static constexpr size_t DefaultChunkSize = 64 * 1024;
+
+	JSONRESPONSE_EXPORT virtual ~JSONSink();
+
+	virtual void write(std::string_view chunk) = 0;
+};
+
+// JSONCallbackSink passes each chunk to a callback, e.g. to append it to a socket or an HTTP
+// response body.
+class JSONCallbackSink : public JSONSink
+{
+public:
+	using Callback = std::function<void(std::string_view chunk)>;
+
+	JSONRESPONSE_EXPORT explicit JSONCallbackSink(Callback&& callback);
+
+	JSONRESPONSE_EXPORT void write(std::string_view chunk) override;
+
+private:
+	Callback _callback;
+};
+
+// JSONFileSink writes each chunk to a std::FILE*, which it does not close. Throws a
+// std::runtime_error if the file is not written completely.
+class JSONFileSink : public JSONSink
+{
+public:
+	JSONRESPONSE_EXPORT explicit JSONFileSink(std::FILE* file) noexcept;
+
+	JSONRESPONSE_EXPORT void write(std::string_view chunk) override;
+
+private:
+	std::FILE* const _file;
+};
+
+// JSONWriter serializes the events from a response::Writer and streams them to the sink in chunks
+// of at most chunkSize bytes, e.g. so Request::resolve can write the response without building a
+// response::Value for the whole document. The last chunk is passed to the sink as soon as the root
+// value is complete.
+class JSONWriter : public Writer
+{
+public:
+	JSONRESPONSE_EXPORT explicit JSONWriter(
+		JSONSink& sink, size_t chunkSize = JSONSink::DefaultChunkSize);
+	JSONRESPONSE_EXPORT ~JSONWriter() override;
+
+	JSONRESPONSE_EXPORT void start_object() override;
+	JSONRESPONSE_EXPORT void add_member(std::string_view key) override;
+	JSONRESPONSE_EXPORT void end_object() override;
+
+	JSONRESPONSE_EXPORT void start_list() override;
+	JSONRESPONSE_EXPORT void end_list() override;
+
+	JSONRESPONSE_EXPORT void write_null() override;
+	JSONRESPONSE_EXPORT void write_string(std::string_view value) override;
+	JSONRESPONSE_EXPORT void write_bool(BooleanType value) override;
+	JSONRESPONSE_EXPORT void write_int(IntType value) override;
+	JSONRESPONSE_EXPORT void write_float(FloatType value) override;
+
+private:
+	struct Impl;
+
+	void endValue();
+
+	std::unique_ptr<Impl> _impl;
+};
+
+// Serialize the response to the sink in chunks of at most chunkSize bytes instead of building the
+// whole document in a std::string, so the peak memory for the output doesn't depend on the size
+// of the response. Each part of the response is released as soon as it has been written.
+JSONRESPONSE_EXPORT void writeJSON(
+	Value&& response, JSONSink& sink, size_t chunkSize = JSONSink::DefaultChunkSize);
+
 JSONRESPONSE_EXPORT Value parseJSON(const std::string& json);
 
 } /* namespace graphql::response */
@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#ifndef MESSAGEPACKRESPONSE_H
+#define MESSAGEPACKRESPONSE_H
+
+// clang-format off
+#ifdef GRAPHQL_DLLEXPORTS
+	#ifdef IMPL_MESSAGEPACKRESPONSE_DLL
+		#define MESSAGEPACKRESPONSE_EXPORT __declspec(dllexport)
+	#else // !IMPL_MESSAGEPACKRESPONSE_DLL
+		#define MESSAGEPACKRESPONSE_EXPORT __declspec(dllimport)
+	#endif // !IMPL_MESSAGEPACKRESPONSE_DLL
+#else // !GRAPHQL_DLLEXPORTS
+	#define MESSAGEPACKRESPONSE_EXPORT
+#endif // !GRAPHQL_DLLEXPORTS
+// clang-format on
+
+#include "graphqlservice/GraphQLResponse.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace graphql::response {
+
+// MessagePack doesn't distinguish between Type::String and Type::EnumValue, or between a
+// Type::Scalar and the value it wraps, so toMessagePack encodes them as extension types. An
+// EnumValue extension holds the UTF-8 bytes of the enum value, and a Scalar extension holds the
+// MessagePack encoding of the value it wraps.
+constexpr std::int8_t MessagePackExtEnumValue = 1;
+constexpr std::int8_t MessagePackExtScalar = 2;
+
+MESSAGEPACKRESPONSE_EXPORT std::vector<std::uint8_t> toMessagePack(Value&& response);
+
+// Throws std::runtime_error if the input isn't a single well-formed MessagePack object, or if it
+// uses a type which doesn't map to a Value, such as bin or an unknown extension type. Integers
+// outside of the 32-bit range supported by GraphQL throw std::overflow_error.
+MESSAGEPACKRESPONSE_EXPORT Value parseMessagePack(const std::vector<std::uint8_t>& msgpack);
+
+} /* namespace graphql::response */
+
+#endif // MESSAGEPACKRESPONSE_H
@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#ifndef PERSISTEDQUERIES_H
+#define PERSISTEDQUERIES_H
+
+#include "graphqlservice/GraphQLService.h"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace graphql::service {
+
+// Compute the lowercase hex encoding of the SHA-256 hash of a query document. This is the same ID
+// that clients send for Automatic Persisted Queries.
+GRAPHQLSERVICE_EXPORT std::string hashQuery(std::string_view query);
+
+// PersistedQueries keeps a bounded cache of parsed and validated queries for a single Request, so
+// resolving the same document again skips parsing, validation, and compiling the execution plan.
+// When it's full, adding another query evicts the least recently used entry. All of the methods
+// may be called concurrently from multiple threads.
+class PersistedQueries
+{
+public:
+	static constexpr size_t DefaultCapacity = 1000;
+
+	GRAPHQLSERVICE_EXPORT explicit PersistedQueries(
+		std::shared_ptr<const Request> service, size_t capacity = DefaultCapacity);
+
+	// Parse and validate the query and store it using the SHA-256 hash as the ID, which is
+	// returned. Throws a peg::parse_error or a schema_exception if the query is not valid.
+	GRAPHQLSERVICE_EXPORT std::string add(std::string_view query);
+
+	// Parse and validate the query and store it using the ID which the client sent along with it,
+	// e.g. when it registers an Automatic Persisted Query. Throws a schema_exception if the ID does
+	// not match the SHA-256 hash of the query.
+	GRAPHQLSERVICE_EXPORT void add(std::string id, std::string_view query);
+
+	// Parse and validate the query and store it using a caller-provided ID, which is not checked
+	// against the query. Adding another query with the same ID replaces the previous entry.
+	GRAPHQLSERVICE_EXPORT void addUnchecked(std::string id, std::string_view query);
+
+	// Look up a query by ID and mark it as the most recently used. Returns nullptr if the ID is
+	// not in the cache. The shared peg::ast may be resolved on other threads, so it must not be
+	// modified.
+	GRAPHQLSERVICE_EXPORT std::shared_ptr<peg::ast> find(const std::string& id);
+
+	GRAPHQLSERVICE_EXPORT bool erase(const std::string& id);
+	GRAPHQLSERVICE_EXPORT void clear();
+
+	GRAPHQLSERVICE_EXPORT size_t size() const;
+	GRAPHQLSERVICE_EXPORT size_t capacity() const noexcept;
+
+	// Resolve a persisted query by ID. If the ID is not in the cache, the result contains a
+	// PersistedQueryNotFound error and the client should retry with the full query.
+	GRAPHQLSERVICE_EXPORT std::future<response::Value> resolve(
+		const std::shared_ptr<RequestState>& state, const std::string& id,
+		const std::string& operationName, response::Value&& variables);
+	GRAPHQLSERVICE_EXPORT std::future<response::Value> resolve(std::launch launch,
+		const std::shared_ptr<RequestState>& state, const std::string& id,
+		const std::string& operationName, response::Value&& variables);
+	GRAPHQLSERVICE_EXPORT std::future<response::Value> resolve(
+		const std::shared_ptr<Executor>& executor, const std::shared_ptr<RequestState>& state,
+		const std::string& id, const std::string& operationName, response::Value&& variables);
+
+private:
+	std::future<response::Value> resolve(std::launch launch,
+		const std::shared_ptr<Executor>& executor, const std::shared_ptr<RequestState>& state,
+		const std::string& id, const std::string& operationName, response::Value&& variables);
+
+	std::shared_ptr<peg::ast> prepare(std::string_view query) const;
+	void insert(std::string&& id, std::shared_ptr<peg::ast>&& query);
+
+	using Entry = std::pair<std::string, std::shared_ptr<peg::ast>>;
+	using EntryList = std::list<Entry>;
+
+	const std::shared_ptr<const Request> _service;
+	const size_t _capacity;
+
+	// The front of the list is the most recently used entry.
+	mutable std::mutex _entryMutex;
+	EntryList _entries;
+	std::unordered_map<std::string, EntryList::iterator> _index;
+};
+
+} /* namespace graphql::service */
+
+#endif // PERSISTEDQUERIES_H
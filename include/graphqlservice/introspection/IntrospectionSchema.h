@@ -81,7 +81,7 @@ class Schema
 	: public service::Object
 {
 protected:
-	explicit Schema();
+	explicit Schema(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::vector<std::shared_ptr<Type>>> getTypes(service::FieldParams&& params) const = 0;
@@ -91,20 +91,23 @@ public:
 	virtual service::FieldResult<std::vector<std::shared_ptr<Directive>>> getDirectives(service::FieldParams&& params) const = 0;
 
 private:
-	std::future<service::ResolverResult> resolveTypes(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveQueryType(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveMutationType(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveSubscriptionType(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveDirectives(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveTypes(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveQueryType(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveMutationType(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveSubscriptionType(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDirectives(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Type
 	: public service::Object
 {
 protected:
-	explicit Type();
+	explicit Type(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<TypeKind> getKind(service::FieldParams&& params) const = 0;
@@ -118,24 +121,27 @@ public:
 	virtual service::FieldResult<std::shared_ptr<Type>> getOfType(service::FieldParams&& params) const = 0;
 
 private:
-	std::future<service::ResolverResult> resolveKind(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveName(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveDescription(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveFields(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveInterfaces(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolvePossibleTypes(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveEnumValues(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveInputFields(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveOfType(service::ResolverParams&& params);
-
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveKind(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveName(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDescription(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveFields(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveInterfaces(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolvePossibleTypes(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveEnumValues(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveInputFields(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveOfType(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Field
 	: public service::Object
 {
 protected:
-	explicit Field();
+	explicit Field(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::StringType> getName(service::FieldParams&& params) const = 0;
@@ -146,21 +152,24 @@ public:
 	virtual service::FieldResult<std::optional<response::StringType>> getDeprecationReason(service::FieldParams&& params) const = 0;
 
 private:
-	std::future<service::ResolverResult> resolveName(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveDescription(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveArgs(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveType(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveIsDeprecated(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveDeprecationReason(service::ResolverParams&& params);
-
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveName(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDescription(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveArgs(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveType(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveIsDeprecated(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDeprecationReason(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class InputValue
 	: public service::Object
 {
 protected:
-	explicit InputValue();
+	explicit InputValue(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::StringType> getName(service::FieldParams&& params) const = 0;
@@ -169,19 +178,22 @@ public:
 	virtual service::FieldResult<std::optional<response::StringType>> getDefaultValue(service::FieldParams&& params) const = 0;
 
 private:
-	std::future<service::ResolverResult> resolveName(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveDescription(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveType(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveDefaultValue(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveName(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDescription(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveType(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDefaultValue(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class EnumValue
 	: public service::Object
 {
 protected:
-	explicit EnumValue();
+	explicit EnumValue(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::StringType> getName(service::FieldParams&& params) const = 0;
@@ -190,19 +202,22 @@ public:
 	virtual service::FieldResult<std::optional<response::StringType>> getDeprecationReason(service::FieldParams&& params) const = 0;
 
 private:
-	std::future<service::ResolverResult> resolveName(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveDescription(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveIsDeprecated(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveDeprecationReason(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveName(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDescription(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveIsDeprecated(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDeprecationReason(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Directive
 	: public service::Object
 {
 protected:
-	explicit Directive();
+	explicit Directive(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::StringType> getName(service::FieldParams&& params) const = 0;
@@ -211,12 +226,15 @@ public:
 	virtual service::FieldResult<std::vector<std::shared_ptr<InputValue>>> getArgs(service::FieldParams&& params) const = 0;
 
 private:
-	std::future<service::ResolverResult> resolveName(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveDescription(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveLocations(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveArgs(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveName(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDescription(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveLocations(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveArgs(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace object */
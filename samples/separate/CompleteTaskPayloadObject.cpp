@@ -18,15 +18,29 @@ using namespace std::literals;
 namespace graphql::today {
 namespace object {
 
-CompleteTaskPayload::CompleteTaskPayload()
-	: service::Object({
+CompleteTaskPayload::CompleteTaskPayload(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& CompleteTaskPayload::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"CompleteTaskPayload"
-	}, {
-		{ R"gql(task)gql"sv, [this](service::ResolverParams&& params) { return resolveTask(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(clientMutationId)gql"sv, [this](service::ResolverParams&& params) { return resolveClientMutationId(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& CompleteTaskPayload::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(task)gql"sv, service::dispatchField<CompleteTaskPayload, &CompleteTaskPayload::resolveTask> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<CompleteTaskPayload, &CompleteTaskPayload::resolve_typename> },
+		{ R"gql(clientMutationId)gql"sv, service::dispatchField<CompleteTaskPayload, &CompleteTaskPayload::resolveClientMutationId> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<std::shared_ptr<Task>> CompleteTaskPayload::getTask(service::FieldParams&&) const
@@ -34,12 +48,16 @@ service::FieldResult<std::shared_ptr<Task>> CompleteTaskPayload::getTask(service
 	throw std::runtime_error(R"ex(CompleteTaskPayload::getTask is not implemented)ex");
 }
 
-std::future<service::ResolverResult> CompleteTaskPayload::resolveTask(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> CompleteTaskPayload::resolveTask(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getTask(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &CompleteTaskPayload::getTask, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Task>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -49,17 +67,21 @@ service::FieldResult<std::optional<response::StringType>> CompleteTaskPayload::g
 	throw std::runtime_error(R"ex(CompleteTaskPayload::getClientMutationId is not implemented)ex");
 }
 
-std::future<service::ResolverResult> CompleteTaskPayload::resolveClientMutationId(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> CompleteTaskPayload::resolveClientMutationId(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getClientMutationId(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &CompleteTaskPayload::getClientMutationId, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> CompleteTaskPayload::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> CompleteTaskPayload::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(CompleteTaskPayload)gql" }, std::move(params));
 }
@@ -16,17 +16,20 @@ class CompleteTaskPayload
 	: public service::Object
 {
 protected:
-	explicit CompleteTaskPayload();
+	explicit CompleteTaskPayload(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<Task>> getTask(service::FieldParams&& params) const;
 	virtual service::FieldResult<std::optional<response::StringType>> getClientMutationId(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveTask(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveClientMutationId(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveTask(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveClientMutationId(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace graphql::today::object */
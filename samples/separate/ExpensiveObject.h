@@ -16,15 +16,18 @@ class Expensive
 	: public service::Object
 {
 protected:
-	explicit Expensive();
+	explicit Expensive(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::IntType> getOrder(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveOrder(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveOrder(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace graphql::today::object */
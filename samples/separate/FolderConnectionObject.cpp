@@ -18,15 +18,29 @@ using namespace std::literals;
 namespace graphql::today {
 namespace object {
 
-FolderConnection::FolderConnection()
-	: service::Object({
+FolderConnection::FolderConnection(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& FolderConnection::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"FolderConnection"
-	}, {
-		{ R"gql(edges)gql"sv, [this](service::ResolverParams&& params) { return resolveEdges(std::move(params)); } },
-		{ R"gql(pageInfo)gql"sv, [this](service::ResolverParams&& params) { return resolvePageInfo(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& FolderConnection::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(edges)gql"sv, service::dispatchField<FolderConnection, &FolderConnection::resolveEdges> },
+		{ R"gql(pageInfo)gql"sv, service::dispatchField<FolderConnection, &FolderConnection::resolvePageInfo> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<FolderConnection, &FolderConnection::resolve_typename> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<std::shared_ptr<PageInfo>> FolderConnection::getPageInfo(service::FieldParams&&) const
@@ -34,12 +48,16 @@ service::FieldResult<std::shared_ptr<PageInfo>> FolderConnection::getPageInfo(se
 	throw std::runtime_error(R"ex(FolderConnection::getPageInfo is not implemented)ex");
 }
 
-std::future<service::ResolverResult> FolderConnection::resolvePageInfo(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> FolderConnection::resolvePageInfo(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getPageInfo(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &FolderConnection::getPageInfo, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<PageInfo>::convert(std::move(result), std::move(params));
 }
@@ -49,17 +67,21 @@ service::FieldResult<std::optional<std::vector<std::shared_ptr<FolderEdge>>>> Fo
 	throw std::runtime_error(R"ex(FolderConnection::getEdges is not implemented)ex");
 }
 
-std::future<service::ResolverResult> FolderConnection::resolveEdges(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> FolderConnection::resolveEdges(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getEdges(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &FolderConnection::getEdges, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<FolderEdge>::convert<service::TypeModifier::Nullable, service::TypeModifier::List, service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> FolderConnection::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> FolderConnection::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(FolderConnection)gql" }, std::move(params));
 }
@@ -16,17 +16,20 @@ class FolderEdge
 	: public service::Object
 {
 protected:
-	explicit FolderEdge();
+	explicit FolderEdge(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<Folder>> getNode(service::FieldParams&& params) const;
 	virtual service::FieldResult<response::Value> getCursor(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveNode(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveCursor(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNode(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveCursor(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace graphql::today::object */
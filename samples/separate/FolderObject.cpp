@@ -18,18 +18,32 @@ using namespace std::literals;
 namespace graphql::today {
 namespace object {
 
-Folder::Folder()
-	: service::Object({
+Folder::Folder(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Folder::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Node",
 		"UnionType",
 		"Folder"
-	}, {
-		{ R"gql(id)gql"sv, [this](service::ResolverParams&& params) { return resolveId(std::move(params)); } },
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(unreadCount)gql"sv, [this](service::ResolverParams&& params) { return resolveUnreadCount(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Folder::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(id)gql"sv, service::dispatchField<Folder, &Folder::resolveId> },
+		{ R"gql(name)gql"sv, service::dispatchField<Folder, &Folder::resolveName> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Folder, &Folder::resolve_typename> },
+		{ R"gql(unreadCount)gql"sv, service::dispatchField<Folder, &Folder::resolveUnreadCount> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<response::IdType> Folder::getId(service::FieldParams&&) const
@@ -37,12 +51,16 @@ service::FieldResult<response::IdType> Folder::getId(service::FieldParams&&) con
 	throw std::runtime_error(R"ex(Folder::getId is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Folder::resolveId(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Folder::resolveId(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getId(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Folder::getId, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::IdType>::convert(std::move(result), std::move(params));
 }
@@ -52,12 +70,16 @@ service::FieldResult<std::optional<response::StringType>> Folder::getName(servic
 	throw std::runtime_error(R"ex(Folder::getName is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Folder::resolveName(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Folder::resolveName(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getName(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Folder::getName, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -67,17 +89,21 @@ service::FieldResult<response::IntType> Folder::getUnreadCount(service::FieldPar
 	throw std::runtime_error(R"ex(Folder::getUnreadCount is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Folder::resolveUnreadCount(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Folder::resolveUnreadCount(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getUnreadCount(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Folder::getUnreadCount, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::IntType>::convert(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Folder::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Folder::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Folder)gql" }, std::move(params));
 }
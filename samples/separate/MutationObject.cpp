@@ -18,15 +18,29 @@ using namespace std::literals;
 namespace graphql::today {
 namespace object {
 
-Mutation::Mutation()
-	: service::Object({
+Mutation::Mutation(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Mutation::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Mutation"
-	}, {
-		{ R"gql(setFloat)gql"sv, [this](service::ResolverParams&& params) { return resolveSetFloat(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(completeTask)gql"sv, [this](service::ResolverParams&& params) { return resolveCompleteTask(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Mutation::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(setFloat)gql"sv, service::dispatchField<Mutation, &Mutation::resolveSetFloat> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Mutation, &Mutation::resolve_typename> },
+		{ R"gql(completeTask)gql"sv, service::dispatchField<Mutation, &Mutation::resolveCompleteTask> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<std::shared_ptr<CompleteTaskPayload>> Mutation::applyCompleteTask(service::FieldParams&&, CompleteTaskInput&&) const
@@ -34,13 +48,17 @@ service::FieldResult<std::shared_ptr<CompleteTaskPayload>> Mutation::applyComple
 	throw std::runtime_error(R"ex(Mutation::applyCompleteTask is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Mutation::resolveCompleteTask(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Mutation::resolveCompleteTask(service::ResolverParams&& params)
 {
 	auto argInput = service::ModifiedArgument<today::CompleteTaskInput>::require("input", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = applyCompleteTask(service::FieldParams(std::move(params), std::move(directives)), std::move(argInput));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Mutation::applyCompleteTask, service::FieldParams(std::move(params), std::move(directives)), std::move(argInput));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<CompleteTaskPayload>::convert(std::move(result), std::move(params));
 }
@@ -50,18 +68,22 @@ service::FieldResult<response::FloatType> Mutation::applySetFloat(service::Field
 	throw std::runtime_error(R"ex(Mutation::applySetFloat is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Mutation::resolveSetFloat(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Mutation::resolveSetFloat(service::ResolverParams&& params)
 {
 	auto argValue = service::ModifiedArgument<response::FloatType>::require("value", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = applySetFloat(service::FieldParams(std::move(params), std::move(directives)), std::move(argValue));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Mutation::applySetFloat, service::FieldParams(std::move(params), std::move(directives)), std::move(argValue));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::FloatType>::convert(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Mutation::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Mutation::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Mutation)gql" }, std::move(params));
 }
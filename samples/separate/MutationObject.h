@@ -16,17 +16,20 @@ class Mutation
 	: public service::Object
 {
 protected:
-	explicit Mutation();
+	explicit Mutation(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<CompleteTaskPayload>> applyCompleteTask(service::FieldParams&& params, CompleteTaskInput&& inputArg) const;
 	virtual service::FieldResult<response::FloatType> applySetFloat(service::FieldParams&& params, response::FloatType&& valueArg) const;
 
 private:
-	std::future<service::ResolverResult> resolveCompleteTask(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveSetFloat(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveCompleteTask(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveSetFloat(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace graphql::today::object */
@@ -18,15 +18,29 @@ using namespace std::literals;
 namespace graphql::today {
 namespace object {
 
-NestedType::NestedType()
-	: service::Object({
+NestedType::NestedType(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& NestedType::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"NestedType"
-	}, {
-		{ R"gql(depth)gql"sv, [this](service::ResolverParams&& params) { return resolveDepth(std::move(params)); } },
-		{ R"gql(nested)gql"sv, [this](service::ResolverParams&& params) { return resolveNested(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& NestedType::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(depth)gql"sv, service::dispatchField<NestedType, &NestedType::resolveDepth> },
+		{ R"gql(nested)gql"sv, service::dispatchField<NestedType, &NestedType::resolveNested> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<NestedType, &NestedType::resolve_typename> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<response::IntType> NestedType::getDepth(service::FieldParams&&) const
@@ -34,12 +48,16 @@ service::FieldResult<response::IntType> NestedType::getDepth(service::FieldParam
 	throw std::runtime_error(R"ex(NestedType::getDepth is not implemented)ex");
 }
 
-std::future<service::ResolverResult> NestedType::resolveDepth(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> NestedType::resolveDepth(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getDepth(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &NestedType::getDepth, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::IntType>::convert(std::move(result), std::move(params));
 }
@@ -49,17 +67,21 @@ service::FieldResult<std::shared_ptr<NestedType>> NestedType::getNested(service:
 	throw std::runtime_error(R"ex(NestedType::getNested is not implemented)ex");
 }
 
-std::future<service::ResolverResult> NestedType::resolveNested(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> NestedType::resolveNested(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getNested(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &NestedType::getNested, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<NestedType>::convert(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> NestedType::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> NestedType::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(NestedType)gql" }, std::move(params));
 }
@@ -16,17 +16,20 @@ class PageInfo
 	: public service::Object
 {
 protected:
-	explicit PageInfo();
+	explicit PageInfo(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::BooleanType> getHasNextPage(service::FieldParams&& params) const;
 	virtual service::FieldResult<response::BooleanType> getHasPreviousPage(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveHasNextPage(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveHasPreviousPage(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveHasNextPage(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveHasPreviousPage(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace graphql::today::object */
@@ -18,40 +18,58 @@ using namespace std::literals;
 namespace graphql::today {
 namespace object {
 
-Query::Query()
-	: service::Object({
-		"Query"
-	}, {
-		{ R"gql(node)gql"sv, [this](service::ResolverParams&& params) { return resolveNode(std::move(params)); } },
-		{ R"gql(tasks)gql"sv, [this](service::ResolverParams&& params) { return resolveTasks(std::move(params)); } },
-		{ R"gql(__type)gql"sv, [this](service::ResolverParams&& params) { return resolve_type(std::move(params)); } },
-		{ R"gql(nested)gql"sv, [this](service::ResolverParams&& params) { return resolveNested(std::move(params)); } },
-		{ R"gql(__schema)gql"sv, [this](service::ResolverParams&& params) { return resolve_schema(std::move(params)); } },
-		{ R"gql(expensive)gql"sv, [this](service::ResolverParams&& params) { return resolveExpensive(std::move(params)); } },
-		{ R"gql(tasksById)gql"sv, [this](service::ResolverParams&& params) { return resolveTasksById(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(appointments)gql"sv, [this](service::ResolverParams&& params) { return resolveAppointments(std::move(params)); } },
-		{ R"gql(unreadCounts)gql"sv, [this](service::ResolverParams&& params) { return resolveUnreadCounts(std::move(params)); } },
-		{ R"gql(unimplemented)gql"sv, [this](service::ResolverParams&& params) { return resolveUnimplemented(std::move(params)); } },
-		{ R"gql(appointmentsById)gql"sv, [this](service::ResolverParams&& params) { return resolveAppointmentsById(std::move(params)); } },
-		{ R"gql(unreadCountsById)gql"sv, [this](service::ResolverParams&& params) { return resolveUnreadCountsById(std::move(params)); } }
-	})
+Query::Query(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
 	, _schema(GetSchema())
 {
 }
 
+const service::TypeNames& Query::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
+		"Query"
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Query::getResolvers() noexcept
+{
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(node)gql"sv, service::dispatchField<Query, &Query::resolveNode> },
+		{ R"gql(tasks)gql"sv, service::dispatchField<Query, &Query::resolveTasks> },
+		{ R"gql(__type)gql"sv, service::dispatchField<Query, &Query::resolve_type> },
+		{ R"gql(nested)gql"sv, service::dispatchField<Query, &Query::resolveNested> },
+		{ R"gql(__schema)gql"sv, service::dispatchField<Query, &Query::resolve_schema> },
+		{ R"gql(expensive)gql"sv, service::dispatchField<Query, &Query::resolveExpensive> },
+		{ R"gql(tasksById)gql"sv, service::dispatchField<Query, &Query::resolveTasksById> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Query, &Query::resolve_typename> },
+		{ R"gql(appointments)gql"sv, service::dispatchField<Query, &Query::resolveAppointments> },
+		{ R"gql(unreadCounts)gql"sv, service::dispatchField<Query, &Query::resolveUnreadCounts> },
+		{ R"gql(unimplemented)gql"sv, service::dispatchField<Query, &Query::resolveUnimplemented> },
+		{ R"gql(appointmentsById)gql"sv, service::dispatchField<Query, &Query::resolveAppointmentsById> },
+		{ R"gql(unreadCountsById)gql"sv, service::dispatchField<Query, &Query::resolveUnreadCountsById> }
+	};
+
+	return s_resolvers;
+}
+
 service::FieldResult<std::shared_ptr<service::Object>> Query::getNode(service::FieldParams&&, response::IdType&&) const
 {
 	throw std::runtime_error(R"ex(Query::getNode is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveNode(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveNode(service::ResolverParams&& params)
 {
 	auto argId = service::ModifiedArgument<response::IdType>::require("id", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getNode(service::FieldParams(std::move(params), std::move(directives)), std::move(argId));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getNode, service::FieldParams(std::move(params), std::move(directives)), std::move(argId));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<service::Object>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -61,16 +79,20 @@ service::FieldResult<std::shared_ptr<AppointmentConnection>> Query::getAppointme
 	throw std::runtime_error(R"ex(Query::getAppointments is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveAppointments(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveAppointments(service::ResolverParams&& params)
 {
 	auto argFirst = service::ModifiedArgument<response::IntType>::require<service::TypeModifier::Nullable>("first", params.arguments);
 	auto argAfter = service::ModifiedArgument<response::Value>::require<service::TypeModifier::Nullable>("after", params.arguments);
 	auto argLast = service::ModifiedArgument<response::IntType>::require<service::TypeModifier::Nullable>("last", params.arguments);
 	auto argBefore = service::ModifiedArgument<response::Value>::require<service::TypeModifier::Nullable>("before", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getAppointments(service::FieldParams(std::move(params), std::move(directives)), std::move(argFirst), std::move(argAfter), std::move(argLast), std::move(argBefore));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getAppointments, service::FieldParams(std::move(params), std::move(directives)), std::move(argFirst), std::move(argAfter), std::move(argLast), std::move(argBefore));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<AppointmentConnection>::convert(std::move(result), std::move(params));
 }
@@ -80,16 +102,20 @@ service::FieldResult<std::shared_ptr<TaskConnection>> Query::getTasks(service::F
 	throw std::runtime_error(R"ex(Query::getTasks is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveTasks(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveTasks(service::ResolverParams&& params)
 {
 	auto argFirst = service::ModifiedArgument<response::IntType>::require<service::TypeModifier::Nullable>("first", params.arguments);
 	auto argAfter = service::ModifiedArgument<response::Value>::require<service::TypeModifier::Nullable>("after", params.arguments);
 	auto argLast = service::ModifiedArgument<response::IntType>::require<service::TypeModifier::Nullable>("last", params.arguments);
 	auto argBefore = service::ModifiedArgument<response::Value>::require<service::TypeModifier::Nullable>("before", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getTasks(service::FieldParams(std::move(params), std::move(directives)), std::move(argFirst), std::move(argAfter), std::move(argLast), std::move(argBefore));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getTasks, service::FieldParams(std::move(params), std::move(directives)), std::move(argFirst), std::move(argAfter), std::move(argLast), std::move(argBefore));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<TaskConnection>::convert(std::move(result), std::move(params));
 }
@@ -99,16 +125,20 @@ service::FieldResult<std::shared_ptr<FolderConnection>> Query::getUnreadCounts(s
 	throw std::runtime_error(R"ex(Query::getUnreadCounts is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveUnreadCounts(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveUnreadCounts(service::ResolverParams&& params)
 {
 	auto argFirst = service::ModifiedArgument<response::IntType>::require<service::TypeModifier::Nullable>("first", params.arguments);
 	auto argAfter = service::ModifiedArgument<response::Value>::require<service::TypeModifier::Nullable>("after", params.arguments);
 	auto argLast = service::ModifiedArgument<response::IntType>::require<service::TypeModifier::Nullable>("last", params.arguments);
 	auto argBefore = service::ModifiedArgument<response::Value>::require<service::TypeModifier::Nullable>("before", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getUnreadCounts(service::FieldParams(std::move(params), std::move(directives)), std::move(argFirst), std::move(argAfter), std::move(argLast), std::move(argBefore));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getUnreadCounts, service::FieldParams(std::move(params), std::move(directives)), std::move(argFirst), std::move(argAfter), std::move(argLast), std::move(argBefore));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<FolderConnection>::convert(std::move(result), std::move(params));
 }
@@ -118,9 +148,9 @@ service::FieldResult<std::vector<std::shared_ptr<Appointment>>> Query::getAppoin
 	throw std::runtime_error(R"ex(Query::getAppointmentsById is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveAppointmentsById(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveAppointmentsById(service::ResolverParams&& params)
 {
-	const auto defaultArguments = []()
+	static const auto defaultArguments = []()
 	{
 		response::Value values(response::Type::Map);
 		response::Value entry;
@@ -143,10 +173,14 @@ std::future<service::ResolverResult> Query::resolveAppointmentsById(service::Res
 	auto argIds = (pairIds.second
 		? std::move(pairIds.first)
 		: service::ModifiedArgument<response::IdType>::require<service::TypeModifier::List>("ids", defaultArguments));
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getAppointmentsById(service::FieldParams(std::move(params), std::move(directives)), std::move(argIds));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getAppointmentsById, service::FieldParams(std::move(params), std::move(directives)), std::move(argIds));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Appointment>::convert<service::TypeModifier::List, service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -156,13 +190,17 @@ service::FieldResult<std::vector<std::shared_ptr<Task>>> Query::getTasksById(ser
 	throw std::runtime_error(R"ex(Query::getTasksById is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveTasksById(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveTasksById(service::ResolverParams&& params)
 {
 	auto argIds = service::ModifiedArgument<response::IdType>::require<service::TypeModifier::List>("ids", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getTasksById(service::FieldParams(std::move(params), std::move(directives)), std::move(argIds));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getTasksById, service::FieldParams(std::move(params), std::move(directives)), std::move(argIds));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Task>::convert<service::TypeModifier::List, service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -172,13 +210,17 @@ service::FieldResult<std::vector<std::shared_ptr<Folder>>> Query::getUnreadCount
 	throw std::runtime_error(R"ex(Query::getUnreadCountsById is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveUnreadCountsById(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveUnreadCountsById(service::ResolverParams&& params)
 {
 	auto argIds = service::ModifiedArgument<response::IdType>::require<service::TypeModifier::List>("ids", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getUnreadCountsById(service::FieldParams(std::move(params), std::move(directives)), std::move(argIds));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getUnreadCountsById, service::FieldParams(std::move(params), std::move(directives)), std::move(argIds));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Folder>::convert<service::TypeModifier::List, service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -188,12 +230,16 @@ service::FieldResult<std::shared_ptr<NestedType>> Query::getNested(service::Fiel
 	throw std::runtime_error(R"ex(Query::getNested is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveNested(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveNested(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getNested(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getNested, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<NestedType>::convert(std::move(result), std::move(params));
 }
@@ -203,12 +249,16 @@ service::FieldResult<response::StringType> Query::getUnimplemented(service::Fiel
 	throw std::runtime_error(R"ex(Query::getUnimplemented is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveUnimplemented(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveUnimplemented(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getUnimplemented(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getUnimplemented, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert(std::move(result), std::move(params));
 }
@@ -218,27 +268,31 @@ service::FieldResult<std::vector<std::shared_ptr<Expensive>>> Query::getExpensiv
 	throw std::runtime_error(R"ex(Query::getExpensive is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveExpensive(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveExpensive(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getExpensive(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getExpensive, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Expensive>::convert<service::TypeModifier::List>(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Query::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Query)gql" }, std::move(params));
 }
 
-std::future<service::ResolverResult> Query::resolve_schema(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolve_schema(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<service::Object>::convert(std::static_pointer_cast<service::Object>(std::make_shared<introspection::Schema>(_schema)), std::move(params));
 }
 
-std::future<service::ResolverResult> Query::resolve_type(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolve_type(service::ResolverParams&& params)
 {
 	auto argName = service::ModifiedArgument<response::StringType>::require("name", params.arguments);
 	const auto& baseType = _schema->LookupType(argName);
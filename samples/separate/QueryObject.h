@@ -16,7 +16,7 @@ class Query
 	: public service::Object
 {
 protected:
-	explicit Query();
+	explicit Query(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<service::Object>> getNode(service::FieldParams&& params, response::IdType&& idArg) const;
@@ -31,20 +31,23 @@ public:
 	virtual service::FieldResult<std::vector<std::shared_ptr<Expensive>>> getExpensive(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveNode(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveAppointments(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveTasks(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveUnreadCounts(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveAppointmentsById(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveTasksById(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveUnreadCountsById(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveNested(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveUnimplemented(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveExpensive(service::ResolverParams&& params);
-
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolve_schema(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolve_type(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNode(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveAppointments(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveTasks(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveUnreadCounts(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveAppointmentsById(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveTasksById(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveUnreadCountsById(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNested(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveUnimplemented(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveExpensive(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_schema(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_type(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 
 	std::shared_ptr<schema::Schema> _schema;
 };
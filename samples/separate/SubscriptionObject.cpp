@@ -18,15 +18,29 @@ using namespace std::literals;
 namespace graphql::today {
 namespace object {
 
-Subscription::Subscription()
-	: service::Object({
+Subscription::Subscription(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Subscription::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Subscription"
-	}, {
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(nodeChange)gql"sv, [this](service::ResolverParams&& params) { return resolveNodeChange(std::move(params)); } },
-		{ R"gql(nextAppointmentChange)gql"sv, [this](service::ResolverParams&& params) { return resolveNextAppointmentChange(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Subscription::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(__typename)gql"sv, service::dispatchField<Subscription, &Subscription::resolve_typename> },
+		{ R"gql(nodeChange)gql"sv, service::dispatchField<Subscription, &Subscription::resolveNodeChange> },
+		{ R"gql(nextAppointmentChange)gql"sv, service::dispatchField<Subscription, &Subscription::resolveNextAppointmentChange> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<std::shared_ptr<Appointment>> Subscription::getNextAppointmentChange(service::FieldParams&&) const
@@ -34,12 +48,16 @@ service::FieldResult<std::shared_ptr<Appointment>> Subscription::getNextAppointm
 	throw std::runtime_error(R"ex(Subscription::getNextAppointmentChange is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Subscription::resolveNextAppointmentChange(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Subscription::resolveNextAppointmentChange(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getNextAppointmentChange(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Subscription::getNextAppointmentChange, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Appointment>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -49,18 +67,22 @@ service::FieldResult<std::shared_ptr<service::Object>> Subscription::getNodeChan
 	throw std::runtime_error(R"ex(Subscription::getNodeChange is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Subscription::resolveNodeChange(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Subscription::resolveNodeChange(service::ResolverParams&& params)
 {
 	auto argId = service::ModifiedArgument<response::IdType>::require("id", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getNodeChange(service::FieldParams(std::move(params), std::move(directives)), std::move(argId));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Subscription::getNodeChange, service::FieldParams(std::move(params), std::move(directives)), std::move(argId));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<service::Object>::convert(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Subscription::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Subscription::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Subscription)gql" }, std::move(params));
 }
@@ -16,17 +16,20 @@ class Subscription
 	: public service::Object
 {
 protected:
-	explicit Subscription();
+	explicit Subscription(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<Appointment>> getNextAppointmentChange(service::FieldParams&& params) const;
 	virtual service::FieldResult<std::shared_ptr<service::Object>> getNodeChange(service::FieldParams&& params, response::IdType&& idArg) const;
 
 private:
-	std::future<service::ResolverResult> resolveNextAppointmentChange(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveNodeChange(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNextAppointmentChange(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNodeChange(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace graphql::today::object */
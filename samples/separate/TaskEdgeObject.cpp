@@ -18,15 +18,29 @@ using namespace std::literals;
 namespace graphql::today {
 namespace object {
 
-TaskEdge::TaskEdge()
-	: service::Object({
+TaskEdge::TaskEdge(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& TaskEdge::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"TaskEdge"
-	}, {
-		{ R"gql(node)gql"sv, [this](service::ResolverParams&& params) { return resolveNode(std::move(params)); } },
-		{ R"gql(cursor)gql"sv, [this](service::ResolverParams&& params) { return resolveCursor(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& TaskEdge::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(node)gql"sv, service::dispatchField<TaskEdge, &TaskEdge::resolveNode> },
+		{ R"gql(cursor)gql"sv, service::dispatchField<TaskEdge, &TaskEdge::resolveCursor> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<TaskEdge, &TaskEdge::resolve_typename> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<std::shared_ptr<Task>> TaskEdge::getNode(service::FieldParams&&) const
@@ -34,12 +48,16 @@ service::FieldResult<std::shared_ptr<Task>> TaskEdge::getNode(service::FieldPara
 	throw std::runtime_error(R"ex(TaskEdge::getNode is not implemented)ex");
 }
 
-std::future<service::ResolverResult> TaskEdge::resolveNode(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> TaskEdge::resolveNode(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getNode(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &TaskEdge::getNode, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Task>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -49,17 +67,21 @@ service::FieldResult<response::Value> TaskEdge::getCursor(service::FieldParams&&
 	throw std::runtime_error(R"ex(TaskEdge::getCursor is not implemented)ex");
 }
 
-std::future<service::ResolverResult> TaskEdge::resolveCursor(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> TaskEdge::resolveCursor(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getCursor(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &TaskEdge::getCursor, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::Value>::convert(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> TaskEdge::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> TaskEdge::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(TaskEdge)gql" }, std::move(params));
 }
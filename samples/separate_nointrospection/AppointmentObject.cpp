@@ -18,20 +18,34 @@ using namespace std::literals;
 namespace graphql::today {
 namespace object {
 
-Appointment::Appointment()
-	: service::Object({
+Appointment::Appointment(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Appointment::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Node",
 		"UnionType",
 		"Appointment"
-	}, {
-		{ R"gql(id)gql"sv, [this](service::ResolverParams&& params) { return resolveId(std::move(params)); } },
-		{ R"gql(when)gql"sv, [this](service::ResolverParams&& params) { return resolveWhen(std::move(params)); } },
-		{ R"gql(isNow)gql"sv, [this](service::ResolverParams&& params) { return resolveIsNow(std::move(params)); } },
-		{ R"gql(subject)gql"sv, [this](service::ResolverParams&& params) { return resolveSubject(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(forceError)gql"sv, [this](service::ResolverParams&& params) { return resolveForceError(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Appointment::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(id)gql"sv, service::dispatchField<Appointment, &Appointment::resolveId> },
+		{ R"gql(when)gql"sv, service::dispatchField<Appointment, &Appointment::resolveWhen> },
+		{ R"gql(isNow)gql"sv, service::dispatchField<Appointment, &Appointment::resolveIsNow> },
+		{ R"gql(subject)gql"sv, service::dispatchField<Appointment, &Appointment::resolveSubject> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Appointment, &Appointment::resolve_typename> },
+		{ R"gql(forceError)gql"sv, service::dispatchField<Appointment, &Appointment::resolveForceError> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<response::IdType> Appointment::getId(service::FieldParams&&) const
@@ -39,12 +53,16 @@ service::FieldResult<response::IdType> Appointment::getId(service::FieldParams&&
 	throw std::runtime_error(R"ex(Appointment::getId is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Appointment::resolveId(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Appointment::resolveId(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getId(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Appointment::getId, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::IdType>::convert(std::move(result), std::move(params));
 }
@@ -54,12 +72,16 @@ service::FieldResult<std::optional<response::Value>> Appointment::getWhen(servic
 	throw std::runtime_error(R"ex(Appointment::getWhen is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Appointment::resolveWhen(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Appointment::resolveWhen(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getWhen(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Appointment::getWhen, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::Value>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -69,12 +91,16 @@ service::FieldResult<std::optional<response::StringType>> Appointment::getSubjec
 	throw std::runtime_error(R"ex(Appointment::getSubject is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Appointment::resolveSubject(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Appointment::resolveSubject(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getSubject(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Appointment::getSubject, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -84,12 +110,16 @@ service::FieldResult<response::BooleanType> Appointment::getIsNow(service::Field
 	throw std::runtime_error(R"ex(Appointment::getIsNow is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Appointment::resolveIsNow(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Appointment::resolveIsNow(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getIsNow(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Appointment::getIsNow, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert(std::move(result), std::move(params));
 }
@@ -99,17 +129,21 @@ service::FieldResult<std::optional<response::StringType>> Appointment::getForceE
 	throw std::runtime_error(R"ex(Appointment::getForceError is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Appointment::resolveForceError(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Appointment::resolveForceError(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getForceError(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Appointment::getForceError, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Appointment::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Appointment::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Appointment)gql" }, std::move(params));
 }
@@ -17,7 +17,7 @@ class Appointment
 	, public Node
 {
 protected:
-	explicit Appointment();
+	explicit Appointment(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::IdType> getId(service::FieldParams&& params) const override;
@@ -27,13 +27,16 @@ public:
 	virtual service::FieldResult<std::optional<response::StringType>> getForceError(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveId(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveWhen(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveSubject(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveIsNow(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveForceError(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveId(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveWhen(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveSubject(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveIsNow(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveForceError(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace graphql::today::object */
@@ -18,14 +18,28 @@ using namespace std::literals;
 namespace graphql::today {
 namespace object {
 
-Expensive::Expensive()
-	: service::Object({
+Expensive::Expensive(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Expensive::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Expensive"
-	}, {
-		{ R"gql(order)gql"sv, [this](service::ResolverParams&& params) { return resolveOrder(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Expensive::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(order)gql"sv, service::dispatchField<Expensive, &Expensive::resolveOrder> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Expensive, &Expensive::resolve_typename> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<response::IntType> Expensive::getOrder(service::FieldParams&&) const
@@ -33,17 +47,21 @@ service::FieldResult<response::IntType> Expensive::getOrder(service::FieldParams
 	throw std::runtime_error(R"ex(Expensive::getOrder is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Expensive::resolveOrder(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Expensive::resolveOrder(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getOrder(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Expensive::getOrder, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::IntType>::convert(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Expensive::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Expensive::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Expensive)gql" }, std::move(params));
 }
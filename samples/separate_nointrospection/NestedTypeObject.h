@@ -16,17 +16,20 @@ class NestedType
 	: public service::Object
 {
 protected:
-	explicit NestedType();
+	explicit NestedType(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::IntType> getDepth(service::FieldParams&& params) const;
 	virtual service::FieldResult<std::shared_ptr<NestedType>> getNested(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveDepth(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveNested(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDepth(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNested(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace graphql::today::object */
@@ -18,15 +18,29 @@ using namespace std::literals;
 namespace graphql::today {
 namespace object {
 
-PageInfo::PageInfo()
-	: service::Object({
+PageInfo::PageInfo(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& PageInfo::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"PageInfo"
-	}, {
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(hasNextPage)gql"sv, [this](service::ResolverParams&& params) { return resolveHasNextPage(std::move(params)); } },
-		{ R"gql(hasPreviousPage)gql"sv, [this](service::ResolverParams&& params) { return resolveHasPreviousPage(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& PageInfo::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(__typename)gql"sv, service::dispatchField<PageInfo, &PageInfo::resolve_typename> },
+		{ R"gql(hasNextPage)gql"sv, service::dispatchField<PageInfo, &PageInfo::resolveHasNextPage> },
+		{ R"gql(hasPreviousPage)gql"sv, service::dispatchField<PageInfo, &PageInfo::resolveHasPreviousPage> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<response::BooleanType> PageInfo::getHasNextPage(service::FieldParams&&) const
@@ -34,12 +48,16 @@ service::FieldResult<response::BooleanType> PageInfo::getHasNextPage(service::Fi
 	throw std::runtime_error(R"ex(PageInfo::getHasNextPage is not implemented)ex");
 }
 
-std::future<service::ResolverResult> PageInfo::resolveHasNextPage(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> PageInfo::resolveHasNextPage(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getHasNextPage(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &PageInfo::getHasNextPage, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert(std::move(result), std::move(params));
 }
@@ -49,17 +67,21 @@ service::FieldResult<response::BooleanType> PageInfo::getHasPreviousPage(service
 	throw std::runtime_error(R"ex(PageInfo::getHasPreviousPage is not implemented)ex");
 }
 
-std::future<service::ResolverResult> PageInfo::resolveHasPreviousPage(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> PageInfo::resolveHasPreviousPage(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getHasPreviousPage(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &PageInfo::getHasPreviousPage, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> PageInfo::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> PageInfo::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(PageInfo)gql" }, std::move(params));
 }
@@ -16,17 +16,20 @@ class TaskConnection
 	: public service::Object
 {
 protected:
-	explicit TaskConnection();
+	explicit TaskConnection(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<PageInfo>> getPageInfo(service::FieldParams&& params) const;
 	virtual service::FieldResult<std::optional<std::vector<std::shared_ptr<TaskEdge>>>> getEdges(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolvePageInfo(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveEdges(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolvePageInfo(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveEdges(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace graphql::today::object */
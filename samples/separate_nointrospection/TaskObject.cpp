@@ -18,18 +18,32 @@ using namespace std::literals;
 namespace graphql::today {
 namespace object {
 
-Task::Task()
-	: service::Object({
+Task::Task(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Task::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Node",
 		"UnionType",
 		"Task"
-	}, {
-		{ R"gql(id)gql"sv, [this](service::ResolverParams&& params) { return resolveId(std::move(params)); } },
-		{ R"gql(title)gql"sv, [this](service::ResolverParams&& params) { return resolveTitle(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(isComplete)gql"sv, [this](service::ResolverParams&& params) { return resolveIsComplete(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Task::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(id)gql"sv, service::dispatchField<Task, &Task::resolveId> },
+		{ R"gql(title)gql"sv, service::dispatchField<Task, &Task::resolveTitle> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Task, &Task::resolve_typename> },
+		{ R"gql(isComplete)gql"sv, service::dispatchField<Task, &Task::resolveIsComplete> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<response::IdType> Task::getId(service::FieldParams&&) const
@@ -37,12 +51,16 @@ service::FieldResult<response::IdType> Task::getId(service::FieldParams&&) const
 	throw std::runtime_error(R"ex(Task::getId is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Task::resolveId(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Task::resolveId(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getId(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Task::getId, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::IdType>::convert(std::move(result), std::move(params));
 }
@@ -52,12 +70,16 @@ service::FieldResult<std::optional<response::StringType>> Task::getTitle(service
 	throw std::runtime_error(R"ex(Task::getTitle is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Task::resolveTitle(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Task::resolveTitle(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getTitle(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Task::getTitle, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -67,17 +89,21 @@ service::FieldResult<response::BooleanType> Task::getIsComplete(service::FieldPa
 	throw std::runtime_error(R"ex(Task::getIsComplete is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Task::resolveIsComplete(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Task::resolveIsComplete(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getIsComplete(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Task::getIsComplete, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Task::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Task::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Task)gql" }, std::move(params));
 }
@@ -17,7 +17,7 @@ class Task
 	, public Node
 {
 protected:
-	explicit Task();
+	explicit Task(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::IdType> getId(service::FieldParams&& params) const override;
@@ -25,11 +25,14 @@ public:
 	virtual service::FieldResult<response::BooleanType> getIsComplete(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveId(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveTitle(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveIsComplete(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveId(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveTitle(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveIsComplete(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace graphql::today::object */
@@ -47,7 +47,7 @@ today::TaskState ModifiedArgument<today::TaskState>::convert(const response::Val
 }
 
 template <>
-std::future<service::ResolverResult> ModifiedResult<today::TaskState>::convert(service::FieldResult<today::TaskState>&& result, ResolverParams&& params)
+service::FieldResult<service::ResolverResult> ModifiedResult<today::TaskState>::convert(service::FieldResult<today::TaskState>&& result, ResolverParams&& params)
 {
 	return resolve(std::move(result), std::move(params),
 		[](today::TaskState&& value, const ResolverParams&)
@@ -63,7 +63,7 @@ std::future<service::ResolverResult> ModifiedResult<today::TaskState>::convert(s
 template <>
 today::CompleteTaskInput ModifiedArgument<today::CompleteTaskInput>::convert(const response::Value& value)
 {
-	const auto defaultValue = []()
+	static const auto defaultValue = []()
 	{
 		response::Value values(response::Type::Map);
 		response::Value entry;
@@ -32,8 +32,9 @@ Folder::Folder(response::IdType&& id, std::string&& name, int unreadCount)
 }
 
 Query::Query(appointmentsLoader&& getAppointments, tasksLoader&& getTasks,
-	unreadCountsLoader&& getUnreadCounts)
-	: _getAppointments(std::move(getAppointments))
+	unreadCountsLoader&& getUnreadCounts, bool threadSafe)
+	: object::Query(threadSafe)
+	, _getAppointments(std::move(getAppointments))
 	, _getTasks(std::move(getTasks))
 	, _getUnreadCounts(getUnreadCounts)
 {
@@ -49,6 +50,8 @@ void Query::loadAppointments(const std::shared_ptr<service::RequestState>& state
 		todayState->loadAppointmentsCount++;
 	}
 
+	std::lock_guard lock { _loadMutex };
+
 	if (_getAppointments)
 	{
 		_appointments = _getAppointments();
@@ -82,6 +85,8 @@ void Query::loadTasks(const std::shared_ptr<service::RequestState>& state) const
 		todayState->loadTasksCount++;
 	}
 
+	std::lock_guard lock { _loadMutex };
+
 	if (_getTasks)
 	{
 		_tasks = _getTasks();
@@ -115,6 +120,8 @@ void Query::loadUnreadCounts(const std::shared_ptr<service::RequestState>& state
 		todayState->loadUnreadCountsCount++;
 	}
 
+	std::lock_guard lock { _loadMutex };
+
 	if (_getUnreadCounts)
 	{
 		_unreadCounts = _getUnreadCounts();
@@ -47,8 +47,10 @@ public:
 	using tasksLoader = std::function<std::vector<std::shared_ptr<Task>>()>;
 	using unreadCountsLoader = std::function<std::vector<std::shared_ptr<Folder>>()>;
 
+	// The loaders are only called once, under the _loadMutex, so the accessors are safe to call
+	// concurrently and a shared Query may opt in to skipping the resolver lock with threadSafe.
 	explicit Query(appointmentsLoader&& getAppointments, tasksLoader&& getTasks,
-		unreadCountsLoader&& getUnreadCounts);
+		unreadCountsLoader&& getUnreadCounts, bool threadSafe = false);
 
 	service::FieldResult<std::shared_ptr<service::Object>> getNode(
 		service::FieldParams&& params, response::IdType&& id) const final;
@@ -88,6 +90,7 @@ private:
 	void loadTasks(const std::shared_ptr<service::RequestState>& state) const;
 	void loadUnreadCounts(const std::shared_ptr<service::RequestState>& state) const;
 
+	mutable std::mutex _loadMutex;
 	mutable appointmentsLoader _getAppointments;
 	mutable tasksLoader _getTasks;
 	mutable unreadCountsLoader _getUnreadCounts;
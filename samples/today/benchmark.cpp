@@ -5,14 +5,31 @@
 
 #include "graphqlservice/JSONResponse.h"
 
+#ifdef GRAPHQL_BUILD_CBOR
+#include "graphqlservice/CBORResponse.h"
+#endif // GRAPHQL_BUILD_CBOR
+
+#ifdef GRAPHQL_BUILD_MESSAGEPACK
+#include "graphqlservice/MessagePackResponse.h"
+#endif // GRAPHQL_BUILD_MESSAGEPACK
+
 #include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <future>
 #include <iostream>
 #include <iterator>
 #include <numeric>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif // __linux__
+
 using namespace graphql;
 
 using namespace std::literals;
@@ -25,7 +42,7 @@ response::IdType binFolderId;
 
 } // namespace
 
-std::shared_ptr<today::Operations> buildService()
+std::shared_ptr<today::Operations> buildService(bool threadSafe)
 {
 	std::string fakeAppointmentId("fakeAppointmentId");
 	binAppointmentId.resize(fakeAppointmentId.size());
@@ -51,7 +68,8 @@ std::shared_ptr<today::Operations> buildService()
 		},
 		[]() -> std::vector<std::shared_ptr<today::Folder>> {
 			return { std::make_shared<today::Folder>(std::move(binFolderId), "\"Fake\" Inbox", 3) };
-		});
+		},
+		threadSafe);
 	auto mutation = std::make_shared<today::Mutation>(
 		[](today::CompleteTaskInput&& input) -> std::shared_ptr<today::CompleteTaskPayload> {
 			return std::make_shared<today::CompleteTaskPayload>(
@@ -108,6 +126,213 @@ void outputSegment(
 			  << " average" << std::endl;
 }
 
+// Flush the file to disk and ask the OS to drop it from the page cache, so the next parse has to read
+// it from disk. This is only implemented on Linux, and even there it's advisory: pages which are
+// still mapped or dirty may stay cached. Returns false if the cold parse can't be measured.
+bool evictFromPageCache(const char* filename)
+{
+#ifdef __linux__
+	const int fd = open(filename, O_RDONLY);
+
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	const bool evicted =
+		fdatasync(fd) == 0 && posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+
+	close(fd);
+
+	return evicted;
+#else  // !__linux__
+	return false;
+#endif // !__linux__
+}
+
+// Measure the time for parsing a multi-megabyte document from a file. The parseFile function maps
+// the file into memory and parses it in place, compared to reading it into a std::string and moving
+// that into parseString. Each of them is timed from opening the file, first after dropping the file
+// from the page cache (cold start), and then again while it's still cached (warm parse).
+void outputLargeDocument()
+{
+	constexpr auto filename = "benchmark.large.graphql";
+	constexpr size_t fragmentCount = 20000;
+	std::ostringstream document;
+
+	document << R"gql(query {
+		appointments {
+			edges {
+				node {
+					...Appointment0
+				}
+			}
+		}
+	}
+	)gql";
+
+	for (size_t i = 0; i < fragmentCount; ++i)
+	{
+		document << R"gql(# Comments and long strings are skipped in bulk by the lexer, so they
+	# should take much less time per byte than the selections.
+	fragment Appointment)gql"
+				 << i << R"gql( on Appointment {
+		id
+		when
+		subject(format: "The quick brown fox jumps over the lazy dog, again and again.")
+		isNow
+	}
+	)gql";
+	}
+
+	const auto text = document.str();
+
+	{
+		std::ofstream file { filename, std::ios::binary };
+
+		file << text;
+	}
+
+	const auto parseMapped = [filename]() {
+		const auto start = std::chrono::steady_clock::now();
+		auto mapped = peg::parseFile(filename);
+		const auto end = std::chrono::steady_clock::now();
+
+		mapped = {};
+
+		return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+	};
+
+	const auto parseRead = [filename]() {
+		const auto start = std::chrono::steady_clock::now();
+		std::ifstream file { filename, std::ios::binary };
+		std::string contents { std::istreambuf_iterator<char> { file },
+			std::istreambuf_iterator<char> {} };
+		auto read = peg::parseString(std::move(contents));
+		const auto end = std::chrono::steady_clock::now();
+
+		read = {};
+
+		return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+	};
+
+	std::cout << "Large document: " << text.size() << " bytes" << std::endl;
+
+	if (evictFromPageCache(filename))
+	{
+		const auto coldMapped = parseMapped();
+
+		evictFromPageCache(filename);
+
+		const auto coldRead = parseRead();
+
+		std::cout << "Parse cold file (microseconds): " << coldMapped << " mapped, " << coldRead
+				  << " read into a string" << std::endl;
+	}
+	else
+	{
+		std::cout << "Parse cold file: skipped, the page cache can't be dropped on this platform"
+				  << std::endl;
+	}
+
+	const auto warmMapped = parseMapped();
+	const auto warmRead = parseRead();
+
+	std::remove(filename);
+
+	std::cout << "Parse cached file (microseconds): " << warmMapped << " mapped, " << warmRead
+			  << " read into a string" << std::endl;
+}
+
+// Compare the size of the same response and the time it takes to encode and decode it as JSON,
+// CBOR, and MessagePack. The binary encodings are skipped if those libraries aren't built.
+void outputEncodings(const std::shared_ptr<today::Operations>& service)
+{
+	constexpr size_t encodingIterations = 10000;
+	auto query = peg::parseString(R"gql(query {
+		appointments {
+			pageInfo { hasNextPage hasPreviousPage }
+			edges { node { id when subject isNow } }
+		}
+		tasks {
+			edges { node { id title isComplete } }
+		}
+		unreadCounts {
+			edges { node { id name unreadCount } }
+		}
+	})gql"sv);
+	const auto response =
+		service->resolve(nullptr, query, "", response::Value(response::Type::Map)).get();
+
+	const auto measure = [&response](std::string_view name, auto encode, auto decode) {
+		// Copy the response ahead of time, so the copies aren't included in the encoding time.
+		std::vector<response::Value> copies;
+
+		copies.reserve(encodingIterations);
+
+		for (size_t i = 0; i < encodingIterations; ++i)
+		{
+			copies.emplace_back(response);
+		}
+
+		auto encoded = encode(response::Value(response));
+		const auto startEncode = std::chrono::steady_clock::now();
+
+		for (auto& copy : copies)
+		{
+			encoded = encode(std::move(copy));
+		}
+
+		const auto startDecode = std::chrono::steady_clock::now();
+
+		for (size_t i = 0; i < encodingIterations; ++i)
+		{
+			decode(encoded);
+		}
+
+		const auto endDecode = std::chrono::steady_clock::now();
+		const auto average = [](std::chrono::steady_clock::duration duration) noexcept {
+			return std::chrono::duration<double, std::micro>(duration).count()
+				/ static_cast<double>(encodingIterations);
+		};
+
+		std::cout << name << ": " << encoded.size() << " bytes, "
+				  << average(startDecode - startEncode) << " encode, "
+				  << average(endDecode - startDecode) << " decode (average microseconds)"
+				  << std::endl;
+	};
+
+	measure(
+		"JSON"sv,
+		[](response::Value&& value) {
+			return response::toJSON(std::move(value));
+		},
+		[](const std::string& json) {
+			return response::parseJSON(json);
+		});
+#ifdef GRAPHQL_BUILD_CBOR
+	measure(
+		"CBOR"sv,
+		[](response::Value&& value) {
+			return response::toCBOR(std::move(value));
+		},
+		[](const std::vector<std::uint8_t>& cbor) {
+			return response::parseCBOR(cbor);
+		});
+#endif // GRAPHQL_BUILD_CBOR
+
+#ifdef GRAPHQL_BUILD_MESSAGEPACK
+	measure(
+		"MessagePack"sv,
+		[](response::Value&& value) {
+			return response::toMessagePack(std::move(value));
+		},
+		[](const std::vector<std::uint8_t>& msgpack) {
+			return response::parseMessagePack(msgpack);
+		});
+#endif // GRAPHQL_BUILD_MESSAGEPACK
+}
+
 int main(int argc, char** argv)
 {
 	const size_t iterations = [](const char* arg) noexcept -> size_t {
@@ -125,18 +350,72 @@ int main(int argc, char** argv)
 		return 100;
 	}((argc > 1) ? argv[1] : nullptr);
 
+	// Optionally resolve the requests on a shared pool of worker threads, otherwise use the
+	// default std::launch::deferred policy on the calling thread.
+	const size_t threadCount = [](const char* arg) noexcept -> size_t {
+		if (arg)
+		{
+			const int parsed = std::atoi(arg);
+
+			if (parsed > 0)
+			{
+				return static_cast<size_t>(parsed);
+			}
+		}
+
+		return 0;
+	}((argc > 2) ? argv[2] : nullptr);
+
+	// Optionally split the iterations across multiple client threads which share the same service
+	// and root objects, to measure contention between concurrent requests.
+	const size_t clientCount = [](const char* arg) noexcept -> size_t {
+		if (arg)
+		{
+			const int parsed = std::atoi(arg);
+
+			if (parsed > 0)
+			{
+				return static_cast<size_t>(parsed);
+			}
+		}
+
+		return 1;
+	}((argc > 3) ? argv[3] : nullptr);
+
+	// Optionally let the client threads call the accessors on the shared Query object without
+	// serializing them on its resolver lock.
+	const bool threadSafe = (argc > 4) && std::atoi(argv[4]) != 0;
+
 	std::cout << "Iterations: " << iterations << std::endl;
 
-	auto service = buildService();
+	std::shared_ptr<service::Executor> executor;
+
+	if (threadCount > 0)
+	{
+		std::cout << "Executor threads: " << threadCount << std::endl;
+		executor = std::make_shared<service::ThreadPoolExecutor>(threadCount);
+	}
+
+	if (clientCount > 1)
+	{
+		std::cout << "Client threads: " << clientCount << std::endl;
+	}
+
+	if (threadSafe)
+	{
+		std::cout << "Thread-safe Query: true" << std::endl;
+	}
+
+	auto service = buildService(threadSafe);
 	std::vector<std::chrono::steady_clock::duration> durationParse(iterations);
 	std::vector<std::chrono::steady_clock::duration> durationValidate(iterations);
 	std::vector<std::chrono::steady_clock::duration> durationResolve(iterations);
 	std::vector<std::chrono::steady_clock::duration> durationToJson(iterations);
+	std::vector<std::chrono::steady_clock::duration> durationDestroy(iterations);
 	const auto startTime = std::chrono::steady_clock::now();
 
-	try
-	{
-		for (size_t i = 0; i < iterations; ++i)
+	const auto runIterations = [&](size_t client) {
+		for (size_t i = client; i < iterations; i += clientCount)
 		{
 			const auto startParse = std::chrono::steady_clock::now();
 			auto query = peg::parseString(R"gql(query {
@@ -157,18 +436,48 @@ int main(int argc, char** argv)
 			service->validate(query);
 
 			const auto startResolve = std::chrono::steady_clock::now();
-			auto response =
-				service->resolve(nullptr, query, "", response::Value(response::Type::Map)).get();
+			auto resolveFuture = executor
+				? service->resolve(executor,
+					nullptr,
+					query,
+					"",
+					response::Value(response::Type::Map))
+				: service->resolve(nullptr, query, "", response::Value(response::Type::Map));
+			auto response = resolveFuture.get();
 			const auto startToJson = std::chrono::steady_clock::now();
 
 			response::toJSON(std::move(response));
 
-			const auto endToJson = std::chrono::steady_clock::now();
+			const auto startDestroy = std::chrono::steady_clock::now();
+
+			query = {};
+
+			const auto endDestroy = std::chrono::steady_clock::now();
 
 			durationParse[i] = startValidate - startParse;
 			durationValidate[i] = startResolve - startValidate;
 			durationResolve[i] = startToJson - startResolve;
-			durationToJson[i] = endToJson - startToJson;
+			durationToJson[i] = startDestroy - startToJson;
+			durationDestroy[i] = endDestroy - startDestroy;
+		}
+	};
+
+	try
+	{
+		std::vector<std::future<void>> clients;
+
+		clients.reserve(clientCount - 1);
+
+		for (size_t client = 1; client < clientCount; ++client)
+		{
+			clients.push_back(std::async(std::launch::async, runIterations, client));
+		}
+
+		runIterations(0);
+
+		for (auto& client : clients)
+		{
+			client.get();
 		}
 	}
 	catch (const std::runtime_error& ex)
@@ -186,6 +495,18 @@ int main(int argc, char** argv)
 	outputSegment("Validate"sv, durationValidate);
 	outputSegment("Resolve"sv, durationResolve);
 	outputSegment("ToJSON"sv, durationToJson);
+	outputSegment("Destroy"sv, durationDestroy);
+
+	try
+	{
+		outputEncodings(service);
+		outputLargeDocument();
+	}
+	catch (const std::exception& ex)
+	{
+		std::cerr << ex.what() << std::endl;
+		return 1;
+	}
 
 	return 0;
 }
@@ -69,7 +69,7 @@ class Query
 	: public service::Object
 {
 protected:
-	explicit Query();
+	explicit Query(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<service::Object>> getNode(service::FieldParams&& params, response::IdType&& idArg) const;
@@ -84,20 +84,23 @@ public:
 	virtual service::FieldResult<std::vector<std::shared_ptr<Expensive>>> getExpensive(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveNode(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveAppointments(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveTasks(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveUnreadCounts(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveAppointmentsById(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveTasksById(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveUnreadCountsById(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveNested(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveUnimplemented(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveExpensive(service::ResolverParams&& params);
-
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolve_schema(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolve_type(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNode(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveAppointments(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveTasks(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveUnreadCounts(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveAppointmentsById(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveTasksById(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveUnreadCountsById(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNested(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveUnimplemented(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveExpensive(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_schema(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_type(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 
 	std::shared_ptr<schema::Schema> _schema;
 };
@@ -106,170 +109,200 @@ class PageInfo
 	: public service::Object
 {
 protected:
-	explicit PageInfo();
+	explicit PageInfo(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::BooleanType> getHasNextPage(service::FieldParams&& params) const;
 	virtual service::FieldResult<response::BooleanType> getHasPreviousPage(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveHasNextPage(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveHasPreviousPage(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveHasNextPage(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveHasPreviousPage(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class AppointmentEdge
 	: public service::Object
 {
 protected:
-	explicit AppointmentEdge();
+	explicit AppointmentEdge(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<Appointment>> getNode(service::FieldParams&& params) const;
 	virtual service::FieldResult<response::Value> getCursor(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveNode(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveCursor(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNode(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveCursor(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class AppointmentConnection
 	: public service::Object
 {
 protected:
-	explicit AppointmentConnection();
+	explicit AppointmentConnection(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<PageInfo>> getPageInfo(service::FieldParams&& params) const;
 	virtual service::FieldResult<std::optional<std::vector<std::shared_ptr<AppointmentEdge>>>> getEdges(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolvePageInfo(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveEdges(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolvePageInfo(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveEdges(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class TaskEdge
 	: public service::Object
 {
 protected:
-	explicit TaskEdge();
+	explicit TaskEdge(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<Task>> getNode(service::FieldParams&& params) const;
 	virtual service::FieldResult<response::Value> getCursor(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveNode(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveCursor(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNode(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveCursor(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class TaskConnection
 	: public service::Object
 {
 protected:
-	explicit TaskConnection();
+	explicit TaskConnection(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<PageInfo>> getPageInfo(service::FieldParams&& params) const;
 	virtual service::FieldResult<std::optional<std::vector<std::shared_ptr<TaskEdge>>>> getEdges(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolvePageInfo(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveEdges(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolvePageInfo(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveEdges(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class FolderEdge
 	: public service::Object
 {
 protected:
-	explicit FolderEdge();
+	explicit FolderEdge(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<Folder>> getNode(service::FieldParams&& params) const;
 	virtual service::FieldResult<response::Value> getCursor(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveNode(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveCursor(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNode(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveCursor(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class FolderConnection
 	: public service::Object
 {
 protected:
-	explicit FolderConnection();
+	explicit FolderConnection(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<PageInfo>> getPageInfo(service::FieldParams&& params) const;
 	virtual service::FieldResult<std::optional<std::vector<std::shared_ptr<FolderEdge>>>> getEdges(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolvePageInfo(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveEdges(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolvePageInfo(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveEdges(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class CompleteTaskPayload
 	: public service::Object
 {
 protected:
-	explicit CompleteTaskPayload();
+	explicit CompleteTaskPayload(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<Task>> getTask(service::FieldParams&& params) const;
 	virtual service::FieldResult<std::optional<response::StringType>> getClientMutationId(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveTask(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveClientMutationId(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveTask(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveClientMutationId(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Mutation
 	: public service::Object
 {
 protected:
-	explicit Mutation();
+	explicit Mutation(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<CompleteTaskPayload>> applyCompleteTask(service::FieldParams&& params, CompleteTaskInput&& inputArg) const;
 	virtual service::FieldResult<response::FloatType> applySetFloat(service::FieldParams&& params, response::FloatType&& valueArg) const;
 
 private:
-	std::future<service::ResolverResult> resolveCompleteTask(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveSetFloat(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveCompleteTask(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveSetFloat(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Subscription
 	: public service::Object
 {
 protected:
-	explicit Subscription();
+	explicit Subscription(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<Appointment>> getNextAppointmentChange(service::FieldParams&& params) const;
 	virtual service::FieldResult<std::shared_ptr<service::Object>> getNodeChange(service::FieldParams&& params, response::IdType&& idArg) const;
 
 private:
-	std::future<service::ResolverResult> resolveNextAppointmentChange(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveNodeChange(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNextAppointmentChange(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNodeChange(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Appointment
@@ -277,7 +310,7 @@ class Appointment
 	, public Node
 {
 protected:
-	explicit Appointment();
+	explicit Appointment(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::IdType> getId(service::FieldParams&& params) const override;
@@ -287,13 +320,16 @@ public:
 	virtual service::FieldResult<std::optional<response::StringType>> getForceError(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveId(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveWhen(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveSubject(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveIsNow(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveForceError(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveId(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveWhen(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveSubject(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveIsNow(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveForceError(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Task
@@ -301,7 +337,7 @@ class Task
 	, public Node
 {
 protected:
-	explicit Task();
+	explicit Task(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::IdType> getId(service::FieldParams&& params) const override;
@@ -309,11 +345,14 @@ public:
 	virtual service::FieldResult<response::BooleanType> getIsComplete(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveId(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveTitle(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveIsComplete(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveId(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveTitle(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveIsComplete(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Folder
@@ -321,7 +360,7 @@ class Folder
 	, public Node
 {
 protected:
-	explicit Folder();
+	explicit Folder(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::IdType> getId(service::FieldParams&& params) const override;
@@ -329,43 +368,52 @@ public:
 	virtual service::FieldResult<response::IntType> getUnreadCount(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveId(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveName(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveUnreadCount(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveId(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveName(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveUnreadCount(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class NestedType
 	: public service::Object
 {
 protected:
-	explicit NestedType();
+	explicit NestedType(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::IntType> getDepth(service::FieldParams&& params) const;
 	virtual service::FieldResult<std::shared_ptr<NestedType>> getNested(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveDepth(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveNested(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDepth(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNested(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Expensive
 	: public service::Object
 {
 protected:
-	explicit Expensive();
+	explicit Expensive(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::IntType> getOrder(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveOrder(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveOrder(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace object */
@@ -46,7 +46,7 @@ validation::DogCommand ModifiedArgument<validation::DogCommand>::convert(const r
 }
 
 template <>
-std::future<service::ResolverResult> ModifiedResult<validation::DogCommand>::convert(service::FieldResult<validation::DogCommand>&& result, ResolverParams&& params)
+service::FieldResult<service::ResolverResult> ModifiedResult<validation::DogCommand>::convert(service::FieldResult<validation::DogCommand>&& result, ResolverParams&& params)
 {
 	return resolve(std::move(result), std::move(params),
 		[](validation::DogCommand&& value, const ResolverParams&)
@@ -82,7 +82,7 @@ validation::CatCommand ModifiedArgument<validation::CatCommand>::convert(const r
 }
 
 template <>
-std::future<service::ResolverResult> ModifiedResult<validation::CatCommand>::convert(service::FieldResult<validation::CatCommand>&& result, ResolverParams&& params)
+service::FieldResult<service::ResolverResult> ModifiedResult<validation::CatCommand>::convert(service::FieldResult<validation::CatCommand>&& result, ResolverParams&& params)
 {
 	return resolve(std::move(result), std::move(params),
 		[](validation::CatCommand&& value, const ResolverParams&)
@@ -112,36 +112,54 @@ validation::ComplexInput ModifiedArgument<validation::ComplexInput>::convert(con
 namespace validation {
 namespace object {
 
-Query::Query()
-	: service::Object({
-		"Query"
-	}, {
-		{ R"gql(dog)gql"sv, [this](service::ResolverParams&& params) { return resolveDog(std::move(params)); } },
-		{ R"gql(pet)gql"sv, [this](service::ResolverParams&& params) { return resolvePet(std::move(params)); } },
-		{ R"gql(human)gql"sv, [this](service::ResolverParams&& params) { return resolveHuman(std::move(params)); } },
-		{ R"gql(__type)gql"sv, [this](service::ResolverParams&& params) { return resolve_type(std::move(params)); } },
-		{ R"gql(findDog)gql"sv, [this](service::ResolverParams&& params) { return resolveFindDog(std::move(params)); } },
-		{ R"gql(__schema)gql"sv, [this](service::ResolverParams&& params) { return resolve_schema(std::move(params)); } },
-		{ R"gql(catOrDog)gql"sv, [this](service::ResolverParams&& params) { return resolveCatOrDog(std::move(params)); } },
-		{ R"gql(arguments)gql"sv, [this](service::ResolverParams&& params) { return resolveArguments(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(booleanList)gql"sv, [this](service::ResolverParams&& params) { return resolveBooleanList(std::move(params)); } }
-	})
+Query::Query(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
 	, _schema(GetSchema())
 {
 }
 
+const service::TypeNames& Query::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
+		"Query"
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Query::getResolvers() noexcept
+{
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(dog)gql"sv, service::dispatchField<Query, &Query::resolveDog> },
+		{ R"gql(pet)gql"sv, service::dispatchField<Query, &Query::resolvePet> },
+		{ R"gql(human)gql"sv, service::dispatchField<Query, &Query::resolveHuman> },
+		{ R"gql(__type)gql"sv, service::dispatchField<Query, &Query::resolve_type> },
+		{ R"gql(findDog)gql"sv, service::dispatchField<Query, &Query::resolveFindDog> },
+		{ R"gql(__schema)gql"sv, service::dispatchField<Query, &Query::resolve_schema> },
+		{ R"gql(catOrDog)gql"sv, service::dispatchField<Query, &Query::resolveCatOrDog> },
+		{ R"gql(arguments)gql"sv, service::dispatchField<Query, &Query::resolveArguments> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Query, &Query::resolve_typename> },
+		{ R"gql(booleanList)gql"sv, service::dispatchField<Query, &Query::resolveBooleanList> }
+	};
+
+	return s_resolvers;
+}
+
 service::FieldResult<std::shared_ptr<Dog>> Query::getDog(service::FieldParams&&) const
 {
 	throw std::runtime_error(R"ex(Query::getDog is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveDog(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveDog(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getDog(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getDog, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Dog>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -151,12 +169,16 @@ service::FieldResult<std::shared_ptr<Human>> Query::getHuman(service::FieldParam
 	throw std::runtime_error(R"ex(Query::getHuman is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveHuman(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveHuman(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getHuman(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getHuman, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Human>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -166,12 +188,16 @@ service::FieldResult<std::shared_ptr<service::Object>> Query::getPet(service::Fi
 	throw std::runtime_error(R"ex(Query::getPet is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolvePet(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolvePet(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getPet(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getPet, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<service::Object>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -181,12 +207,16 @@ service::FieldResult<std::shared_ptr<service::Object>> Query::getCatOrDog(servic
 	throw std::runtime_error(R"ex(Query::getCatOrDog is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveCatOrDog(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveCatOrDog(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getCatOrDog(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getCatOrDog, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<service::Object>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -196,12 +226,16 @@ service::FieldResult<std::shared_ptr<Arguments>> Query::getArguments(service::Fi
 	throw std::runtime_error(R"ex(Query::getArguments is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveArguments(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveArguments(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getArguments(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getArguments, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Arguments>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -211,13 +245,17 @@ service::FieldResult<std::shared_ptr<Dog>> Query::getFindDog(service::FieldParam
 	throw std::runtime_error(R"ex(Query::getFindDog is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveFindDog(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveFindDog(service::ResolverParams&& params)
 {
 	auto argComplex = service::ModifiedArgument<validation::ComplexInput>::require<service::TypeModifier::Nullable>("complex", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getFindDog(service::FieldParams(std::move(params), std::move(directives)), std::move(argComplex));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getFindDog, service::FieldParams(std::move(params), std::move(directives)), std::move(argComplex));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Dog>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -227,28 +265,32 @@ service::FieldResult<std::optional<response::BooleanType>> Query::getBooleanList
 	throw std::runtime_error(R"ex(Query::getBooleanList is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Query::resolveBooleanList(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolveBooleanList(service::ResolverParams&& params)
 {
 	auto argBooleanListArg = service::ModifiedArgument<response::BooleanType>::require<service::TypeModifier::Nullable, service::TypeModifier::List>("booleanListArg", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getBooleanList(service::FieldParams(std::move(params), std::move(directives)), std::move(argBooleanListArg));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Query::getBooleanList, service::FieldParams(std::move(params), std::move(directives)), std::move(argBooleanListArg));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Query::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Query)gql" }, std::move(params));
 }
 
-std::future<service::ResolverResult> Query::resolve_schema(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolve_schema(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<service::Object>::convert(std::static_pointer_cast<service::Object>(std::make_shared<introspection::Schema>(_schema)), std::move(params));
 }
 
-std::future<service::ResolverResult> Query::resolve_type(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Query::resolve_type(service::ResolverParams&& params)
 {
 	auto argName = service::ModifiedArgument<response::StringType>::require("name", params.arguments);
 	const auto& baseType = _schema->LookupType(argName);
@@ -257,22 +299,36 @@ std::future<service::ResolverResult> Query::resolve_type(service::ResolverParams
 	return service::ModifiedResult<introspection::object::Type>::convert<service::TypeModifier::Nullable>(result, std::move(params));
 }
 
-Dog::Dog()
-	: service::Object({
+Dog::Dog(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Dog::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Pet",
 		"CatOrDog",
 		"DogOrHuman",
 		"Dog"
-	}, {
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(owner)gql"sv, [this](service::ResolverParams&& params) { return resolveOwner(std::move(params)); } },
-		{ R"gql(nickname)gql"sv, [this](service::ResolverParams&& params) { return resolveNickname(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(barkVolume)gql"sv, [this](service::ResolverParams&& params) { return resolveBarkVolume(std::move(params)); } },
-		{ R"gql(isHousetrained)gql"sv, [this](service::ResolverParams&& params) { return resolveIsHousetrained(std::move(params)); } },
-		{ R"gql(doesKnowCommand)gql"sv, [this](service::ResolverParams&& params) { return resolveDoesKnowCommand(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Dog::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(name)gql"sv, service::dispatchField<Dog, &Dog::resolveName> },
+		{ R"gql(owner)gql"sv, service::dispatchField<Dog, &Dog::resolveOwner> },
+		{ R"gql(nickname)gql"sv, service::dispatchField<Dog, &Dog::resolveNickname> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Dog, &Dog::resolve_typename> },
+		{ R"gql(barkVolume)gql"sv, service::dispatchField<Dog, &Dog::resolveBarkVolume> },
+		{ R"gql(isHousetrained)gql"sv, service::dispatchField<Dog, &Dog::resolveIsHousetrained> },
+		{ R"gql(doesKnowCommand)gql"sv, service::dispatchField<Dog, &Dog::resolveDoesKnowCommand> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<response::StringType> Dog::getName(service::FieldParams&&) const
@@ -280,12 +336,16 @@ service::FieldResult<response::StringType> Dog::getName(service::FieldParams&&)
 	throw std::runtime_error(R"ex(Dog::getName is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Dog::resolveName(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Dog::resolveName(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getName(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Dog::getName, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert(std::move(result), std::move(params));
 }
@@ -295,12 +355,16 @@ service::FieldResult<std::optional<response::StringType>> Dog::getNickname(servi
 	throw std::runtime_error(R"ex(Dog::getNickname is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Dog::resolveNickname(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Dog::resolveNickname(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getNickname(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Dog::getNickname, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -310,12 +374,16 @@ service::FieldResult<std::optional<response::IntType>> Dog::getBarkVolume(servic
 	throw std::runtime_error(R"ex(Dog::getBarkVolume is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Dog::resolveBarkVolume(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Dog::resolveBarkVolume(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getBarkVolume(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Dog::getBarkVolume, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::IntType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -325,13 +393,17 @@ service::FieldResult<response::BooleanType> Dog::getDoesKnowCommand(service::Fie
 	throw std::runtime_error(R"ex(Dog::getDoesKnowCommand is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Dog::resolveDoesKnowCommand(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Dog::resolveDoesKnowCommand(service::ResolverParams&& params)
 {
 	auto argDogCommand = service::ModifiedArgument<DogCommand>::require("dogCommand", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getDoesKnowCommand(service::FieldParams(std::move(params), std::move(directives)), std::move(argDogCommand));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Dog::getDoesKnowCommand, service::FieldParams(std::move(params), std::move(directives)), std::move(argDogCommand));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert(std::move(result), std::move(params));
 }
@@ -341,13 +413,17 @@ service::FieldResult<response::BooleanType> Dog::getIsHousetrained(service::Fiel
 	throw std::runtime_error(R"ex(Dog::getIsHousetrained is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Dog::resolveIsHousetrained(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Dog::resolveIsHousetrained(service::ResolverParams&& params)
 {
 	auto argAtOtherHomes = service::ModifiedArgument<response::BooleanType>::require<service::TypeModifier::Nullable>("atOtherHomes", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getIsHousetrained(service::FieldParams(std::move(params), std::move(directives)), std::move(argAtOtherHomes));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Dog::getIsHousetrained, service::FieldParams(std::move(params), std::move(directives)), std::move(argAtOtherHomes));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert(std::move(result), std::move(params));
 }
@@ -357,32 +433,50 @@ service::FieldResult<std::shared_ptr<Human>> Dog::getOwner(service::FieldParams&
 	throw std::runtime_error(R"ex(Dog::getOwner is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Dog::resolveOwner(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Dog::resolveOwner(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getOwner(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Dog::getOwner, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Human>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Dog::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Dog::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Dog)gql" }, std::move(params));
 }
 
-Alien::Alien()
-	: service::Object({
+Alien::Alien(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Alien::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Sentient",
 		"HumanOrAlien",
 		"Alien"
-	}, {
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(homePlanet)gql"sv, [this](service::ResolverParams&& params) { return resolveHomePlanet(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Alien::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(name)gql"sv, service::dispatchField<Alien, &Alien::resolveName> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Alien, &Alien::resolve_typename> },
+		{ R"gql(homePlanet)gql"sv, service::dispatchField<Alien, &Alien::resolveHomePlanet> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<response::StringType> Alien::getName(service::FieldParams&&) const
@@ -390,12 +484,16 @@ service::FieldResult<response::StringType> Alien::getName(service::FieldParams&&
 	throw std::runtime_error(R"ex(Alien::getName is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Alien::resolveName(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Alien::resolveName(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getName(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Alien::getName, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert(std::move(result), std::move(params));
 }
@@ -405,33 +503,51 @@ service::FieldResult<std::optional<response::StringType>> Alien::getHomePlanet(s
 	throw std::runtime_error(R"ex(Alien::getHomePlanet is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Alien::resolveHomePlanet(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Alien::resolveHomePlanet(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getHomePlanet(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Alien::getHomePlanet, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Alien::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Alien::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Alien)gql" }, std::move(params));
 }
 
-Human::Human()
-	: service::Object({
+Human::Human(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Human::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Sentient",
 		"DogOrHuman",
 		"HumanOrAlien",
 		"Human"
-	}, {
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(pets)gql"sv, [this](service::ResolverParams&& params) { return resolvePets(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Human::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(name)gql"sv, service::dispatchField<Human, &Human::resolveName> },
+		{ R"gql(pets)gql"sv, service::dispatchField<Human, &Human::resolvePets> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Human, &Human::resolve_typename> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<response::StringType> Human::getName(service::FieldParams&&) const
@@ -439,12 +555,16 @@ service::FieldResult<response::StringType> Human::getName(service::FieldParams&&
 	throw std::runtime_error(R"ex(Human::getName is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Human::resolveName(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Human::resolveName(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getName(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Human::getName, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert(std::move(result), std::move(params));
 }
@@ -454,34 +574,52 @@ service::FieldResult<std::vector<std::shared_ptr<service::Object>>> Human::getPe
 	throw std::runtime_error(R"ex(Human::getPets is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Human::resolvePets(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Human::resolvePets(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getPets(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Human::getPets, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<service::Object>::convert<service::TypeModifier::List>(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Human::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Human::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Human)gql" }, std::move(params));
 }
 
-Cat::Cat()
-	: service::Object({
+Cat::Cat(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Cat::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Pet",
 		"CatOrDog",
 		"Cat"
-	}, {
-		{ R"gql(name)gql"sv, [this](service::ResolverParams&& params) { return resolveName(std::move(params)); } },
-		{ R"gql(nickname)gql"sv, [this](service::ResolverParams&& params) { return resolveNickname(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(meowVolume)gql"sv, [this](service::ResolverParams&& params) { return resolveMeowVolume(std::move(params)); } },
-		{ R"gql(doesKnowCommand)gql"sv, [this](service::ResolverParams&& params) { return resolveDoesKnowCommand(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Cat::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(name)gql"sv, service::dispatchField<Cat, &Cat::resolveName> },
+		{ R"gql(nickname)gql"sv, service::dispatchField<Cat, &Cat::resolveNickname> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Cat, &Cat::resolve_typename> },
+		{ R"gql(meowVolume)gql"sv, service::dispatchField<Cat, &Cat::resolveMeowVolume> },
+		{ R"gql(doesKnowCommand)gql"sv, service::dispatchField<Cat, &Cat::resolveDoesKnowCommand> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<response::StringType> Cat::getName(service::FieldParams&&) const
@@ -489,12 +627,16 @@ service::FieldResult<response::StringType> Cat::getName(service::FieldParams&&)
 	throw std::runtime_error(R"ex(Cat::getName is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Cat::resolveName(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Cat::resolveName(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getName(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Cat::getName, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert(std::move(result), std::move(params));
 }
@@ -504,12 +646,16 @@ service::FieldResult<std::optional<response::StringType>> Cat::getNickname(servi
 	throw std::runtime_error(R"ex(Cat::getNickname is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Cat::resolveNickname(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Cat::resolveNickname(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getNickname(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Cat::getNickname, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -519,13 +665,17 @@ service::FieldResult<response::BooleanType> Cat::getDoesKnowCommand(service::Fie
 	throw std::runtime_error(R"ex(Cat::getDoesKnowCommand is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Cat::resolveDoesKnowCommand(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Cat::resolveDoesKnowCommand(service::ResolverParams&& params)
 {
 	auto argCatCommand = service::ModifiedArgument<CatCommand>::require("catCommand", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getDoesKnowCommand(service::FieldParams(std::move(params), std::move(directives)), std::move(argCatCommand));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Cat::getDoesKnowCommand, service::FieldParams(std::move(params), std::move(directives)), std::move(argCatCommand));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert(std::move(result), std::move(params));
 }
@@ -535,29 +685,47 @@ service::FieldResult<std::optional<response::IntType>> Cat::getMeowVolume(servic
 	throw std::runtime_error(R"ex(Cat::getMeowVolume is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Cat::resolveMeowVolume(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Cat::resolveMeowVolume(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getMeowVolume(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Cat::getMeowVolume, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::IntType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Cat::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Cat::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Cat)gql" }, std::move(params));
 }
 
-Mutation::Mutation()
-	: service::Object({
+Mutation::Mutation(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Mutation::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Mutation"
-	}, {
-		{ R"gql(mutateDog)gql"sv, [this](service::ResolverParams&& params) { return resolveMutateDog(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Mutation::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(mutateDog)gql"sv, service::dispatchField<Mutation, &Mutation::resolveMutateDog> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Mutation, &Mutation::resolve_typename> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<std::shared_ptr<MutateDogResult>> Mutation::applyMutateDog(service::FieldParams&&) const
@@ -565,29 +733,47 @@ service::FieldResult<std::shared_ptr<MutateDogResult>> Mutation::applyMutateDog(
 	throw std::runtime_error(R"ex(Mutation::applyMutateDog is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Mutation::resolveMutateDog(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Mutation::resolveMutateDog(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = applyMutateDog(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Mutation::applyMutateDog, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<MutateDogResult>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Mutation::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Mutation::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Mutation)gql" }, std::move(params));
 }
 
-MutateDogResult::MutateDogResult()
-	: service::Object({
+MutateDogResult::MutateDogResult(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& MutateDogResult::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"MutateDogResult"
-	}, {
-		{ R"gql(id)gql"sv, [this](service::ResolverParams&& params) { return resolveId(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& MutateDogResult::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(id)gql"sv, service::dispatchField<MutateDogResult, &MutateDogResult::resolveId> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<MutateDogResult, &MutateDogResult::resolve_typename> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<response::IdType> MutateDogResult::getId(service::FieldParams&&) const
@@ -595,30 +781,48 @@ service::FieldResult<response::IdType> MutateDogResult::getId(service::FieldPara
 	throw std::runtime_error(R"ex(MutateDogResult::getId is not implemented)ex");
 }
 
-std::future<service::ResolverResult> MutateDogResult::resolveId(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> MutateDogResult::resolveId(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getId(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &MutateDogResult::getId, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::IdType>::convert(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> MutateDogResult::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> MutateDogResult::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(MutateDogResult)gql" }, std::move(params));
 }
 
-Subscription::Subscription()
-	: service::Object({
+Subscription::Subscription(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Subscription::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Subscription"
-	}, {
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(newMessage)gql"sv, [this](service::ResolverParams&& params) { return resolveNewMessage(std::move(params)); } },
-		{ R"gql(disallowedSecondRootField)gql"sv, [this](service::ResolverParams&& params) { return resolveDisallowedSecondRootField(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Subscription::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(__typename)gql"sv, service::dispatchField<Subscription, &Subscription::resolve_typename> },
+		{ R"gql(newMessage)gql"sv, service::dispatchField<Subscription, &Subscription::resolveNewMessage> },
+		{ R"gql(disallowedSecondRootField)gql"sv, service::dispatchField<Subscription, &Subscription::resolveDisallowedSecondRootField> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<std::shared_ptr<Message>> Subscription::getNewMessage(service::FieldParams&&) const
@@ -626,12 +830,16 @@ service::FieldResult<std::shared_ptr<Message>> Subscription::getNewMessage(servi
 	throw std::runtime_error(R"ex(Subscription::getNewMessage is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Subscription::resolveNewMessage(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Subscription::resolveNewMessage(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getNewMessage(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Subscription::getNewMessage, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<Message>::convert(std::move(result), std::move(params));
 }
@@ -641,30 +849,48 @@ service::FieldResult<response::BooleanType> Subscription::getDisallowedSecondRoo
 	throw std::runtime_error(R"ex(Subscription::getDisallowedSecondRootField is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Subscription::resolveDisallowedSecondRootField(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Subscription::resolveDisallowedSecondRootField(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getDisallowedSecondRootField(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Subscription::getDisallowedSecondRootField, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Subscription::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Subscription::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Subscription)gql" }, std::move(params));
 }
 
-Message::Message()
-	: service::Object({
+Message::Message(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Message::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Message"
-	}, {
-		{ R"gql(body)gql"sv, [this](service::ResolverParams&& params) { return resolveBody(std::move(params)); } },
-		{ R"gql(sender)gql"sv, [this](service::ResolverParams&& params) { return resolveSender(std::move(params)); } },
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Message::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(body)gql"sv, service::dispatchField<Message, &Message::resolveBody> },
+		{ R"gql(sender)gql"sv, service::dispatchField<Message, &Message::resolveSender> },
+		{ R"gql(__typename)gql"sv, service::dispatchField<Message, &Message::resolve_typename> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<std::optional<response::StringType>> Message::getBody(service::FieldParams&&) const
@@ -672,12 +898,16 @@ service::FieldResult<std::optional<response::StringType>> Message::getBody(servi
 	throw std::runtime_error(R"ex(Message::getBody is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Message::resolveBody(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Message::resolveBody(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getBody(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Message::getBody, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::StringType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -687,36 +917,54 @@ service::FieldResult<response::IdType> Message::getSender(service::FieldParams&&
 	throw std::runtime_error(R"ex(Message::getSender is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Message::resolveSender(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Message::resolveSender(service::ResolverParams&& params)
 {
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getSender(service::FieldParams(std::move(params), std::move(directives)));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Message::getSender, service::FieldParams(std::move(params), std::move(directives)));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::IdType>::convert(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Message::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Message::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Message)gql" }, std::move(params));
 }
 
-Arguments::Arguments()
-	: service::Object({
+Arguments::Arguments(bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe)
+{
+}
+
+const service::TypeNames& Arguments::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 		"Arguments"
-	}, {
-		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } },
-		{ R"gql(intArgField)gql"sv, [this](service::ResolverParams&& params) { return resolveIntArgField(std::move(params)); } },
-		{ R"gql(multipleReqs)gql"sv, [this](service::ResolverParams&& params) { return resolveMultipleReqs(std::move(params)); } },
-		{ R"gql(floatArgField)gql"sv, [this](service::ResolverParams&& params) { return resolveFloatArgField(std::move(params)); } },
-		{ R"gql(booleanArgField)gql"sv, [this](service::ResolverParams&& params) { return resolveBooleanArgField(std::move(params)); } },
-		{ R"gql(booleanListArgField)gql"sv, [this](service::ResolverParams&& params) { return resolveBooleanListArgField(std::move(params)); } },
-		{ R"gql(nonNullBooleanArgField)gql"sv, [this](service::ResolverParams&& params) { return resolveNonNullBooleanArgField(std::move(params)); } },
-		{ R"gql(nonNullBooleanListField)gql"sv, [this](service::ResolverParams&& params) { return resolveNonNullBooleanListField(std::move(params)); } },
-		{ R"gql(optionalNonNullBooleanArgField)gql"sv, [this](service::ResolverParams&& params) { return resolveOptionalNonNullBooleanArgField(std::move(params)); } }
-	})
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& Arguments::getResolvers() noexcept
 {
+	static const service::FieldResolverMap s_resolvers {
+		{ R"gql(__typename)gql"sv, service::dispatchField<Arguments, &Arguments::resolve_typename> },
+		{ R"gql(intArgField)gql"sv, service::dispatchField<Arguments, &Arguments::resolveIntArgField> },
+		{ R"gql(multipleReqs)gql"sv, service::dispatchField<Arguments, &Arguments::resolveMultipleReqs> },
+		{ R"gql(floatArgField)gql"sv, service::dispatchField<Arguments, &Arguments::resolveFloatArgField> },
+		{ R"gql(booleanArgField)gql"sv, service::dispatchField<Arguments, &Arguments::resolveBooleanArgField> },
+		{ R"gql(booleanListArgField)gql"sv, service::dispatchField<Arguments, &Arguments::resolveBooleanListArgField> },
+		{ R"gql(nonNullBooleanArgField)gql"sv, service::dispatchField<Arguments, &Arguments::resolveNonNullBooleanArgField> },
+		{ R"gql(nonNullBooleanListField)gql"sv, service::dispatchField<Arguments, &Arguments::resolveNonNullBooleanListField> },
+		{ R"gql(optionalNonNullBooleanArgField)gql"sv, service::dispatchField<Arguments, &Arguments::resolveOptionalNonNullBooleanArgField> }
+	};
+
+	return s_resolvers;
 }
 
 service::FieldResult<response::IntType> Arguments::getMultipleReqs(service::FieldParams&&, response::IntType&&, response::IntType&&) const
@@ -724,14 +972,18 @@ service::FieldResult<response::IntType> Arguments::getMultipleReqs(service::Fiel
 	throw std::runtime_error(R"ex(Arguments::getMultipleReqs is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Arguments::resolveMultipleReqs(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Arguments::resolveMultipleReqs(service::ResolverParams&& params)
 {
 	auto argX = service::ModifiedArgument<response::IntType>::require("x", params.arguments);
 	auto argY = service::ModifiedArgument<response::IntType>::require("y", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getMultipleReqs(service::FieldParams(std::move(params), std::move(directives)), std::move(argX), std::move(argY));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Arguments::getMultipleReqs, service::FieldParams(std::move(params), std::move(directives)), std::move(argX), std::move(argY));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::IntType>::convert(std::move(result), std::move(params));
 }
@@ -741,13 +993,17 @@ service::FieldResult<std::optional<response::BooleanType>> Arguments::getBoolean
 	throw std::runtime_error(R"ex(Arguments::getBooleanArgField is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Arguments::resolveBooleanArgField(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Arguments::resolveBooleanArgField(service::ResolverParams&& params)
 {
 	auto argBooleanArg = service::ModifiedArgument<response::BooleanType>::require<service::TypeModifier::Nullable>("booleanArg", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getBooleanArgField(service::FieldParams(std::move(params), std::move(directives)), std::move(argBooleanArg));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Arguments::getBooleanArgField, service::FieldParams(std::move(params), std::move(directives)), std::move(argBooleanArg));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -757,13 +1013,17 @@ service::FieldResult<std::optional<response::FloatType>> Arguments::getFloatArgF
 	throw std::runtime_error(R"ex(Arguments::getFloatArgField is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Arguments::resolveFloatArgField(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Arguments::resolveFloatArgField(service::ResolverParams&& params)
 {
 	auto argFloatArg = service::ModifiedArgument<response::FloatType>::require<service::TypeModifier::Nullable>("floatArg", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getFloatArgField(service::FieldParams(std::move(params), std::move(directives)), std::move(argFloatArg));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Arguments::getFloatArgField, service::FieldParams(std::move(params), std::move(directives)), std::move(argFloatArg));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::FloatType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -773,13 +1033,17 @@ service::FieldResult<std::optional<response::IntType>> Arguments::getIntArgField
 	throw std::runtime_error(R"ex(Arguments::getIntArgField is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Arguments::resolveIntArgField(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Arguments::resolveIntArgField(service::ResolverParams&& params)
 {
 	auto argIntArg = service::ModifiedArgument<response::IntType>::require<service::TypeModifier::Nullable>("intArg", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getIntArgField(service::FieldParams(std::move(params), std::move(directives)), std::move(argIntArg));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Arguments::getIntArgField, service::FieldParams(std::move(params), std::move(directives)), std::move(argIntArg));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::IntType>::convert<service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -789,13 +1053,17 @@ service::FieldResult<response::BooleanType> Arguments::getNonNullBooleanArgField
 	throw std::runtime_error(R"ex(Arguments::getNonNullBooleanArgField is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Arguments::resolveNonNullBooleanArgField(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Arguments::resolveNonNullBooleanArgField(service::ResolverParams&& params)
 {
 	auto argNonNullBooleanArg = service::ModifiedArgument<response::BooleanType>::require("nonNullBooleanArg", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getNonNullBooleanArgField(service::FieldParams(std::move(params), std::move(directives)), std::move(argNonNullBooleanArg));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Arguments::getNonNullBooleanArgField, service::FieldParams(std::move(params), std::move(directives)), std::move(argNonNullBooleanArg));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert(std::move(result), std::move(params));
 }
@@ -805,13 +1073,17 @@ service::FieldResult<std::optional<std::vector<response::BooleanType>>> Argument
 	throw std::runtime_error(R"ex(Arguments::getNonNullBooleanListField is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Arguments::resolveNonNullBooleanListField(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Arguments::resolveNonNullBooleanListField(service::ResolverParams&& params)
 {
 	auto argNonNullBooleanListArg = service::ModifiedArgument<response::BooleanType>::require<service::TypeModifier::Nullable, service::TypeModifier::List>("nonNullBooleanListArg", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getNonNullBooleanListField(service::FieldParams(std::move(params), std::move(directives)), std::move(argNonNullBooleanListArg));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Arguments::getNonNullBooleanListField, service::FieldParams(std::move(params), std::move(directives)), std::move(argNonNullBooleanListArg));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert<service::TypeModifier::Nullable, service::TypeModifier::List>(std::move(result), std::move(params));
 }
@@ -821,13 +1093,17 @@ service::FieldResult<std::optional<std::vector<std::optional<response::BooleanTy
 	throw std::runtime_error(R"ex(Arguments::getBooleanListArgField is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Arguments::resolveBooleanListArgField(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Arguments::resolveBooleanListArgField(service::ResolverParams&& params)
 {
 	auto argBooleanListArg = service::ModifiedArgument<response::BooleanType>::require<service::TypeModifier::List, service::TypeModifier::Nullable>("booleanListArg", params.arguments);
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getBooleanListArgField(service::FieldParams(std::move(params), std::move(directives)), std::move(argBooleanListArg));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Arguments::getBooleanListArgField, service::FieldParams(std::move(params), std::move(directives)), std::move(argBooleanListArg));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert<service::TypeModifier::Nullable, service::TypeModifier::List, service::TypeModifier::Nullable>(std::move(result), std::move(params));
 }
@@ -837,9 +1113,9 @@ service::FieldResult<response::BooleanType> Arguments::getOptionalNonNullBoolean
 	throw std::runtime_error(R"ex(Arguments::getOptionalNonNullBooleanArgField is not implemented)ex");
 }
 
-std::future<service::ResolverResult> Arguments::resolveOptionalNonNullBooleanArgField(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Arguments::resolveOptionalNonNullBooleanArgField(service::ResolverParams&& params)
 {
-	const auto defaultArguments = []()
+	static const auto defaultArguments = []()
 	{
 		response::Value values(response::Type::Map);
 		response::Value entry;
@@ -854,15 +1130,19 @@ std::future<service::ResolverResult> Arguments::resolveOptionalNonNullBooleanArg
 	auto argOptionalBooleanArg = (pairOptionalBooleanArg.second
 		? std::move(pairOptionalBooleanArg.first)
 		: service::ModifiedArgument<response::BooleanType>::require("optionalBooleanArg", defaultArguments));
-	std::unique_lock resolverLock(_resolverMutex);
+	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = getOptionalNonNullBooleanArgField(service::FieldParams(std::move(params), std::move(directives)), std::move(argOptionalBooleanArg));
-	resolverLock.unlock();
+	auto result = service::invokeAccessor(*this, &Arguments::getOptionalNonNullBooleanArgField, service::FieldParams(std::move(params), std::move(directives)), std::move(argOptionalBooleanArg));
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return service::ModifiedResult<response::BooleanType>::convert(std::move(result), std::move(params));
 }
 
-std::future<service::ResolverResult> Arguments::resolve_typename(service::ResolverParams&& params)
+service::FieldResult<service::ResolverResult> Arguments::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql(Arguments)gql" }, std::move(params));
 }
@@ -74,7 +74,7 @@ class Query
 	: public service::Object
 {
 protected:
-	explicit Query();
+	explicit Query(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<Dog>> getDog(service::FieldParams&& params) const;
@@ -86,17 +86,20 @@ public:
 	virtual service::FieldResult<std::optional<response::BooleanType>> getBooleanList(service::FieldParams&& params, std::optional<std::vector<response::BooleanType>>&& booleanListArgArg) const;
 
 private:
-	std::future<service::ResolverResult> resolveDog(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveHuman(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolvePet(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveCatOrDog(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveArguments(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveFindDog(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveBooleanList(service::ResolverParams&& params);
-
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolve_schema(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolve_type(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDog(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveHuman(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolvePet(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveCatOrDog(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveArguments(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveFindDog(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveBooleanList(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_schema(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_type(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 
 	std::shared_ptr<schema::Schema> _schema;
 };
@@ -106,7 +109,7 @@ class Dog
 	, public Pet
 {
 protected:
-	explicit Dog();
+	explicit Dog(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::StringType> getName(service::FieldParams&& params) const override;
@@ -117,14 +120,17 @@ public:
 	virtual service::FieldResult<std::shared_ptr<Human>> getOwner(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveName(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveNickname(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveBarkVolume(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveDoesKnowCommand(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveIsHousetrained(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveOwner(service::ResolverParams&& params);
-
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveName(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNickname(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveBarkVolume(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDoesKnowCommand(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveIsHousetrained(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveOwner(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Alien
@@ -132,17 +138,20 @@ class Alien
 	, public Sentient
 {
 protected:
-	explicit Alien();
+	explicit Alien(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::StringType> getName(service::FieldParams&& params) const override;
 	virtual service::FieldResult<std::optional<response::StringType>> getHomePlanet(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveName(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveHomePlanet(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveName(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveHomePlanet(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Human
@@ -150,17 +159,20 @@ class Human
 	, public Sentient
 {
 protected:
-	explicit Human();
+	explicit Human(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::StringType> getName(service::FieldParams&& params) const override;
 	virtual service::FieldResult<std::vector<std::shared_ptr<service::Object>>> getPets(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveName(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolvePets(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveName(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolvePets(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Cat
@@ -168,7 +180,7 @@ class Cat
 	, public Pet
 {
 protected:
-	explicit Cat();
+	explicit Cat(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::StringType> getName(service::FieldParams&& params) const override;
@@ -177,83 +189,98 @@ public:
 	virtual service::FieldResult<std::optional<response::IntType>> getMeowVolume(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveName(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveNickname(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveDoesKnowCommand(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveMeowVolume(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveName(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNickname(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDoesKnowCommand(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveMeowVolume(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Mutation
 	: public service::Object
 {
 protected:
-	explicit Mutation();
+	explicit Mutation(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<MutateDogResult>> applyMutateDog(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveMutateDog(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveMutateDog(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class MutateDogResult
 	: public service::Object
 {
 protected:
-	explicit MutateDogResult();
+	explicit MutateDogResult(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::IdType> getId(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveId(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveId(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Subscription
 	: public service::Object
 {
 protected:
-	explicit Subscription();
+	explicit Subscription(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::shared_ptr<Message>> getNewMessage(service::FieldParams&& params) const;
 	virtual service::FieldResult<response::BooleanType> getDisallowedSecondRootField(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveNewMessage(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveDisallowedSecondRootField(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNewMessage(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveDisallowedSecondRootField(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Message
 	: public service::Object
 {
 protected:
-	explicit Message();
+	explicit Message(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<std::optional<response::StringType>> getBody(service::FieldParams&& params) const;
 	virtual service::FieldResult<response::IdType> getSender(service::FieldParams&& params) const;
 
 private:
-	std::future<service::ResolverResult> resolveBody(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveSender(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveBody(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveSender(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 class Arguments
 	: public service::Object
 {
 protected:
-	explicit Arguments();
+	explicit Arguments(bool threadSafe = false);
 
 public:
 	virtual service::FieldResult<response::IntType> getMultipleReqs(service::FieldParams&& params, response::IntType&& xArg, response::IntType&& yArg) const;
@@ -266,16 +293,19 @@ public:
 	virtual service::FieldResult<response::BooleanType> getOptionalNonNullBooleanArgField(service::FieldParams&& params, response::BooleanType&& optionalBooleanArgArg) const;
 
 private:
-	std::future<service::ResolverResult> resolveMultipleReqs(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveBooleanArgField(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveFloatArgField(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveIntArgField(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveNonNullBooleanArgField(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveNonNullBooleanListField(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveBooleanListArgField(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolveOptionalNonNullBooleanArgField(service::ResolverParams&& params);
-
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveMultipleReqs(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveBooleanArgField(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveFloatArgField(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveIntArgField(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNonNullBooleanArgField(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveNonNullBooleanListField(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveBooleanListArgField(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolveOptionalNonNullBooleanArgField(service::ResolverParams&& params);
+
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
 };
 
 } /* namespace object */
@@ -0,0 +1,588 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "graphqlservice/CBORResponse.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace graphql::response {
+
+// The major type is in the high 3 bits of the initial byte of each data item, and the low 5 bits
+// hold the additional information, which is either the argument itself or the size of the argument
+// which follows.
+enum class MajorType : std::uint8_t
+{
+	UnsignedInt = 0,
+	NegativeInt = 1,
+	ByteString = 2,
+	TextString = 3,
+	Array = 4,
+	Map = 5,
+	Tag = 6,
+	Simple = 7,
+};
+
+constexpr std::uint8_t cborInfoMask = 0x1F;
+constexpr std::uint8_t cborInfoUint8 = 24;
+constexpr std::uint8_t cborInfoUint16 = 25;
+constexpr std::uint8_t cborInfoUint32 = 26;
+constexpr std::uint8_t cborInfoUint64 = 27;
+constexpr std::uint8_t cborInfoIndefinite = 31;
+
+constexpr std::uint8_t cborFalse = 0xF4;
+constexpr std::uint8_t cborTrue = 0xF5;
+constexpr std::uint8_t cborNull = 0xF6;
+constexpr std::uint8_t cborUndefined = 0xF7;
+constexpr std::uint8_t cborHalfFloat = 0xF9;
+constexpr std::uint8_t cborSingleFloat = 0xFA;
+constexpr std::uint8_t cborDoubleFloat = 0xFB;
+constexpr std::uint8_t cborBreak = 0xFF;
+
+class CBOREncoder
+{
+public:
+	explicit CBOREncoder(std::vector<std::uint8_t>& output)
+		: _output { output }
+	{
+	}
+
+	void encode(Value&& response)
+	{
+		switch (response.type())
+		{
+			case Type::Map:
+			{
+				auto members = response.release<MapType>();
+
+				writeHead(MajorType::Map, members.size());
+
+				for (auto& entry : members)
+				{
+					writeText(entry.first);
+					encode(std::move(entry.second));
+				}
+
+				break;
+			}
+
+			case Type::List:
+			{
+				auto elements = response.release<ListType>();
+
+				writeHead(MajorType::Array, elements.size());
+
+				for (auto& entry : elements)
+				{
+					encode(std::move(entry));
+				}
+
+				break;
+			}
+
+			case Type::String:
+			{
+				writeText(response.get<StringType>());
+				break;
+			}
+
+			case Type::EnumValue:
+			{
+				writeHead(MajorType::Tag, CBORTagEnumValue);
+				writeText(response.get<StringType>());
+				break;
+			}
+
+			case Type::Null:
+			{
+				_output.push_back(cborNull);
+				break;
+			}
+
+			case Type::Boolean:
+			{
+				_output.push_back(response.get<BooleanType>() ? cborTrue : cborFalse);
+				break;
+			}
+
+			case Type::Int:
+			{
+				const auto value = static_cast<std::int64_t>(response.get<IntType>());
+
+				if (value < 0)
+				{
+					writeHead(MajorType::NegativeInt, static_cast<std::uint64_t>(-1 - value));
+				}
+				else
+				{
+					writeHead(MajorType::UnsignedInt, static_cast<std::uint64_t>(value));
+				}
+
+				break;
+			}
+
+			case Type::Float:
+			{
+				const auto value = response.get<FloatType>();
+				std::uint64_t bits;
+
+				static_assert(sizeof(bits) == sizeof(value), "FloatType should be 64-bit");
+				std::memcpy(&bits, &value, sizeof(bits));
+				_output.push_back(cborDoubleFloat);
+				writeBigEndian(bits, sizeof(bits));
+				break;
+			}
+
+			case Type::Scalar:
+			{
+				writeHead(MajorType::Tag, CBORTagScalar);
+				encode(response.release<ScalarType>());
+				break;
+			}
+
+			default:
+			{
+				_output.push_back(cborNull);
+				break;
+			}
+		}
+	}
+
+private:
+	void writeBigEndian(std::uint64_t value, size_t size)
+	{
+		for (size_t shift = size * 8; shift > 0; shift -= 8)
+		{
+			_output.push_back(static_cast<std::uint8_t>(value >> (shift - 8)));
+		}
+	}
+
+	// Always use the shortest encoding of the argument.
+	void writeHead(MajorType majorType, std::uint64_t argument)
+	{
+		const auto major = static_cast<std::uint8_t>(static_cast<std::uint8_t>(majorType) << 5);
+
+		if (argument < cborInfoUint8)
+		{
+			_output.push_back(static_cast<std::uint8_t>(major | argument));
+		}
+		else if (argument <= std::numeric_limits<std::uint8_t>::max())
+		{
+			_output.push_back(major | cborInfoUint8);
+			writeBigEndian(argument, sizeof(std::uint8_t));
+		}
+		else if (argument <= std::numeric_limits<std::uint16_t>::max())
+		{
+			_output.push_back(major | cborInfoUint16);
+			writeBigEndian(argument, sizeof(std::uint16_t));
+		}
+		else if (argument <= std::numeric_limits<std::uint32_t>::max())
+		{
+			_output.push_back(major | cborInfoUint32);
+			writeBigEndian(argument, sizeof(std::uint32_t));
+		}
+		else
+		{
+			_output.push_back(major | cborInfoUint64);
+			writeBigEndian(argument, sizeof(std::uint64_t));
+		}
+	}
+
+	void writeText(std::string_view text)
+	{
+		writeHead(MajorType::TextString, text.size());
+		_output.insert(_output.end(), text.cbegin(), text.cend());
+	}
+
+	std::vector<std::uint8_t>& _output;
+};
+
+std::vector<std::uint8_t> toCBOR(Value&& response)
+{
+	std::vector<std::uint8_t> cbor;
+
+	CBOREncoder(cbor).encode(std::move(response));
+
+	return cbor;
+}
+
+class CBORDecoder
+{
+public:
+	explicit CBORDecoder(const std::vector<std::uint8_t>& input)
+		: _input { input }
+	{
+	}
+
+	Value decode()
+	{
+		auto response = decodeItem();
+
+		if (_offset != _input.size())
+		{
+			throw std::runtime_error("Unexpected data after the CBOR value");
+		}
+
+		return response;
+	}
+
+private:
+	std::uint8_t next()
+	{
+		if (_offset >= _input.size())
+		{
+			throw std::runtime_error("Unexpected end of the CBOR value");
+		}
+
+		return _input[_offset++];
+	}
+
+	bool nextIsBreak()
+	{
+		if (_offset < _input.size() && _input[_offset] == cborBreak)
+		{
+			++_offset;
+			return true;
+		}
+
+		return false;
+	}
+
+	std::uint64_t readBigEndian(size_t size)
+	{
+		if (_input.size() - _offset < size)
+		{
+			throw std::runtime_error("Unexpected end of the CBOR value");
+		}
+
+		std::uint64_t value = 0;
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			value = (value << 8) | _input[_offset++];
+		}
+
+		return value;
+	}
+
+	std::uint64_t readArgument(std::uint8_t info)
+	{
+		switch (info)
+		{
+			case cborInfoUint8:
+				return readBigEndian(sizeof(std::uint8_t));
+
+			case cborInfoUint16:
+				return readBigEndian(sizeof(std::uint16_t));
+
+			case cborInfoUint32:
+				return readBigEndian(sizeof(std::uint32_t));
+
+			case cborInfoUint64:
+				return readBigEndian(sizeof(std::uint64_t));
+
+			default:
+				if (info < cborInfoUint8)
+				{
+					return info;
+				}
+
+				throw std::runtime_error("Invalid CBOR additional information");
+		}
+	}
+
+	// Don't trust the length from the input to reserve space for the elements, each of them takes
+	// at least 1 byte.
+	size_t reserveCount(std::uint64_t count) const noexcept
+	{
+		return static_cast<size_t>(
+			std::min<std::uint64_t>(count, static_cast<std::uint64_t>(_input.size() - _offset)));
+	}
+
+	void readTextChunk(std::uint8_t info, std::string& text)
+	{
+		const auto length = readArgument(info);
+
+		if (length > static_cast<std::uint64_t>(_input.size() - _offset))
+		{
+			throw std::runtime_error("Unexpected end of the CBOR value");
+		}
+
+		const auto begin = _input.cbegin() + static_cast<std::ptrdiff_t>(_offset);
+
+		text.append(begin, begin + static_cast<std::ptrdiff_t>(length));
+		_offset += static_cast<size_t>(length);
+	}
+
+	std::string readText(std::uint8_t info)
+	{
+		std::string text;
+
+		if (info != cborInfoIndefinite)
+		{
+			readTextChunk(info, text);
+			return text;
+		}
+
+		// An indefinite length text string is a sequence of definite length text strings.
+		while (!nextIsBreak())
+		{
+			const auto initial = next();
+
+			if (static_cast<MajorType>(initial >> 5) != MajorType::TextString
+				|| (initial & cborInfoMask) == cborInfoIndefinite)
+			{
+				throw std::runtime_error("Invalid chunk in a CBOR text string");
+			}
+
+			readTextChunk(initial & cborInfoMask, text);
+		}
+
+		return text;
+	}
+
+	std::string decodeKey()
+	{
+		const auto initial = next();
+
+		if (static_cast<MajorType>(initial >> 5) != MajorType::TextString)
+		{
+			throw std::runtime_error("CBOR map keys must be text strings");
+		}
+
+		return readText(initial & cborInfoMask);
+	}
+
+	static Value makeInt(std::int64_t value)
+	{
+		// http://spec.graphql.org/June2018/#sec-Int
+		if (value < std::numeric_limits<IntType>::min()
+			|| value > std::numeric_limits<IntType>::max())
+		{
+			throw std::overflow_error("GraphQL only supports 32-bit signed integers");
+		}
+
+		return Value(static_cast<IntType>(value));
+	}
+
+	static Value makeFloat(FloatType value)
+	{
+		Value response(Type::Float);
+
+		response.set<FloatType>(value);
+
+		return response;
+	}
+
+	// https://www.rfc-editor.org/rfc/rfc8949.html#name-half-precision
+	static FloatType decodeHalf(std::uint16_t half)
+	{
+		const int exponent = (half >> 10) & 0x1F;
+		const int mantissa = half & 0x3FF;
+		FloatType value;
+
+		if (exponent == 0)
+		{
+			value = std::ldexp(mantissa, -24);
+		}
+		else if (exponent != 31)
+		{
+			value = std::ldexp(mantissa + 1024, exponent - 25);
+		}
+		else
+		{
+			value = (mantissa == 0) ? std::numeric_limits<FloatType>::infinity()
+									: std::numeric_limits<FloatType>::quiet_NaN();
+		}
+
+		return (half & 0x8000) ? -value : value;
+	}
+
+	Value decodeItem()
+	{
+		const auto initial = next();
+		const auto info = static_cast<std::uint8_t>(initial & cborInfoMask);
+
+		switch (static_cast<MajorType>(initial >> 5))
+		{
+			case MajorType::UnsignedInt:
+			{
+				const auto argument = readArgument(info);
+
+				if (argument > static_cast<std::uint64_t>(std::numeric_limits<IntType>::max()))
+				{
+					// http://spec.graphql.org/June2018/#sec-Int
+					throw std::overflow_error("GraphQL only supports 32-bit signed integers");
+				}
+
+				return makeInt(static_cast<std::int64_t>(argument));
+			}
+
+			case MajorType::NegativeInt:
+			{
+				const auto argument = readArgument(info);
+
+				if (argument > static_cast<std::uint64_t>(std::numeric_limits<IntType>::max()))
+				{
+					// http://spec.graphql.org/June2018/#sec-Int
+					throw std::overflow_error("GraphQL only supports 32-bit signed integers");
+				}
+
+				return makeInt(-1 - static_cast<std::int64_t>(argument));
+			}
+
+			case MajorType::ByteString:
+				throw std::runtime_error("CBOR byte strings are not supported");
+
+			case MajorType::TextString:
+				return Value(readText(info));
+
+			case MajorType::Array:
+			{
+				Value response(Type::List);
+
+				if (info == cborInfoIndefinite)
+				{
+					while (!nextIsBreak())
+					{
+						response.emplace_back(decodeItem());
+					}
+				}
+				else
+				{
+					const auto count = readArgument(info);
+
+					response.reserve(reserveCount(count));
+
+					for (std::uint64_t i = 0; i < count; ++i)
+					{
+						response.emplace_back(decodeItem());
+					}
+				}
+
+				return response;
+			}
+
+			case MajorType::Map:
+			{
+				Value response(Type::Map);
+
+				if (info == cborInfoIndefinite)
+				{
+					while (!nextIsBreak())
+					{
+						auto key = decodeKey();
+
+						response.emplace_back(std::move(key), decodeItem());
+					}
+				}
+				else
+				{
+					const auto count = readArgument(info);
+
+					response.reserve(reserveCount(count));
+
+					for (std::uint64_t i = 0; i < count; ++i)
+					{
+						auto key = decodeKey();
+
+						response.emplace_back(std::move(key), decodeItem());
+					}
+				}
+
+				return response;
+			}
+
+			case MajorType::Tag:
+			{
+				const auto tag = readArgument(info);
+
+				if (tag == CBORTagEnumValue)
+				{
+					auto text = decodeItem();
+
+					if (text.type() != Type::String)
+					{
+						throw std::runtime_error("Invalid CBOR enum value");
+					}
+
+					Value response(Type::EnumValue);
+
+					response.set<StringType>(text.release<StringType>());
+
+					return response;
+				}
+				else if (tag == CBORTagScalar)
+				{
+					Value response(Type::Scalar);
+
+					response.set<ScalarType>(decodeItem());
+
+					return response;
+				}
+
+				// Ignore any other tags and just use the value.
+				return decodeItem();
+			}
+
+			case MajorType::Simple:
+			{
+				switch (initial)
+				{
+					case cborFalse:
+						return Value(false);
+
+					case cborTrue:
+						return Value(true);
+
+					case cborNull:
+					case cborUndefined:
+						return Value();
+
+					case cborHalfFloat:
+						return makeFloat(
+							decodeHalf(static_cast<std::uint16_t>(readBigEndian(2))));
+
+					case cborSingleFloat:
+					{
+						const auto bits = static_cast<std::uint32_t>(readBigEndian(4));
+						float value;
+
+						std::memcpy(&value, &bits, sizeof(value));
+
+						return makeFloat(static_cast<FloatType>(value));
+					}
+
+					case cborDoubleFloat:
+					{
+						const auto bits = readBigEndian(8);
+						FloatType value;
+
+						std::memcpy(&value, &bits, sizeof(value));
+
+						return makeFloat(value);
+					}
+
+					default:
+						throw std::runtime_error("Unsupported CBOR simple value");
+				}
+			}
+		}
+
+		throw std::runtime_error("Invalid CBOR major type");
+	}
+
+	const std::vector<std::uint8_t>& _input;
+	size_t _offset = 0;
+};
+
+Value parseCBOR(const std::vector<std::uint8_t>& cbor)
+{
+	return CBORDecoder(cbor).decode();
+}
+
+} /* namespace graphql::response */
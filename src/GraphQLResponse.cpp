@@ -652,4 +652,86 @@ const Value& Value::operator[](size_t index) const
 	return std::get<ListType>(_data).at(index);
 }
 
+Writer::~Writer() = default;
+
+void Writer::write(Value&& value)
+{
+	switch (value.type())
+	{
+		case Type::Map:
+		{
+			auto members = value.release<MapType>();
+
+			start_object();
+
+			for (auto& entry : members)
+			{
+				add_member(entry.first);
+				write(std::move(entry.second));
+			}
+
+			end_object();
+			break;
+		}
+
+		case Type::List:
+		{
+			auto elements = value.release<ListType>();
+
+			start_list();
+
+			for (auto& entry : elements)
+			{
+				write(std::move(entry));
+			}
+
+			end_list();
+			break;
+		}
+
+		case Type::String:
+		case Type::EnumValue:
+		{
+			write_string(value.release<StringType>());
+			break;
+		}
+
+		case Type::Null:
+		{
+			write_null();
+			break;
+		}
+
+		case Type::Boolean:
+		{
+			write_bool(value.get<BooleanType>());
+			break;
+		}
+
+		case Type::Int:
+		{
+			write_int(value.get<IntType>());
+			break;
+		}
+
+		case Type::Float:
+		{
+			write_float(value.get<FloatType>());
+			break;
+		}
+
+		case Type::Scalar:
+		{
+			write(value.release<ScalarType>());
+			break;
+		}
+
+		default:
+		{
+			write_null();
+			break;
+		}
+	}
+}
+
 } /* namespace graphql::response */
@@ -63,6 +63,7 @@ const std::shared_ptr<const BaseType>& Schema::LookupType(std::string_view name)
 std::shared_ptr<const BaseType> Schema::WrapType(
 	introspection::TypeKind kind, std::shared_ptr<const BaseType> ofType)
 {
+	std::lock_guard lock { _wrapperMutex };
 	auto& wrappers = (kind == introspection::TypeKind::LIST) ? _listWrappers : _nonNullWrappers;
 	auto itr = wrappers.find(ofType);
 
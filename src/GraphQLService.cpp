@@ -9,6 +9,8 @@
 #include <algorithm>
 #include <array>
 #include <iostream>
+#include <unordered_map>
+#include <utility>
 
 namespace graphql::service {
 
@@ -40,13 +42,8 @@ void addErrorLocation(const schema_location& location, response::Value& error)
 	error.emplace_back(std::string { strLocations }, std::move(errorLocations));
 }
 
-void addErrorPath(const error_path& path, response::Value& error)
+response::Value buildPathValue(const error_path& path)
 {
-	if (path.empty())
-	{
-		return;
-	}
-
 	response::Value errorPath(response::Type::List);
 
 	errorPath.reserve(path.size());
@@ -64,7 +61,17 @@ void addErrorPath(const error_path& path, response::Value& error)
 		}
 	}
 
-	error.emplace_back(std::string { strPath }, std::move(errorPath));
+	return errorPath;
+}
+
+void addErrorPath(const error_path& path, response::Value& error)
+{
+	if (path.empty())
+	{
+		return;
+	}
+
+	error.emplace_back(std::string { strPath }, buildPathValue(path));
 }
 
 error_path buildErrorPath(const std::optional<field_path>& path)
@@ -75,10 +82,9 @@ error_path buildErrorPath(const std::optional<field_path>& path)
 	{
 		std::list<std::reference_wrapper<const path_segment>> segments;
 
-		for (auto segment = std::make_optional(std::cref(*path)); segment;
-			 segment = segment->get().parent)
+		for (auto segment = &*path; segment; segment = segment->parent.get())
 		{
-			segments.push_front(std::cref(segment->get().segment));
+			segments.push_front(std::cref(segment->segment));
 		}
 
 		result.reserve(segments.size());
@@ -163,8 +169,117 @@ response::Value schema_exception::getErrors()
 	return buildErrorValues(std::move(_structuredErrors));
 }
 
+namespace {
+
+// Count the nested visits on each thread, so a thread which waits for a batch in the middle of
+// visiting a selection set or list dispatches it instead of waiting for itself.
+thread_local size_t t_batchVisiting = 0;
+
+} // namespace
+
+void BatchDispatcher::add(DispatchCallback&& dispatch)
+{
+	_callbacks.push_back(std::move(dispatch));
+}
+
+void BatchDispatcher::begin() noexcept
+{
+	++t_batchVisiting;
+	++_visiting;
+}
+
+void BatchDispatcher::end() noexcept
+{
+	--t_batchVisiting;
+
+	if (--_visiting == 0)
+	{
+		for (const auto& dispatch : _callbacks)
+		{
+			dispatch();
+		}
+	}
+}
+
+bool BatchDispatcher::shouldDispatch() const noexcept
+{
+	return _visiting == 0 || t_batchVisiting > 0;
+}
+
+Executor::~Executor()
+{
+}
+
+ThreadPoolExecutor::ThreadPoolExecutor(size_t threadCount)
+{
+	// std::thread::hardware_concurrency may return 0 if it can't tell how many threads are supported.
+	threadCount = std::max(threadCount, size_t { 1 });
+	_workers.reserve(threadCount);
+
+	for (size_t i = 0; i < threadCount; ++i)
+	{
+		_workers.emplace_back([this]() {
+			runWorker();
+		});
+	}
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor()
+{
+	{
+		std::lock_guard lock(_taskMutex);
+
+		_stopping = true;
+	}
+
+	_taskCondition.notify_all();
+
+	for (auto& worker : _workers)
+	{
+		worker.join();
+	}
+}
+
+void ThreadPoolExecutor::post(std::function<void()>&& task)
+{
+	{
+		std::lock_guard lock(_taskMutex);
+
+		_tasks.push(std::move(task));
+	}
+
+	_taskCondition.notify_one();
+}
+
+void ThreadPoolExecutor::runWorker()
+{
+	std::unique_lock lock(_taskMutex);
+
+	while (true)
+	{
+		_taskCondition.wait(lock, [this]() noexcept {
+			return _stopping || !_tasks.empty();
+		});
+
+		// Finish any queued tasks before stopping, since something may still be waiting on them.
+		if (_tasks.empty())
+		{
+			break;
+		}
+
+		auto task = std::move(_tasks.front());
+
+		_tasks.pop();
+		lock.unlock();
+		task();
+		lock.lock();
+	}
+}
+
+// The resolvers still pass the same ResolverParams to ModifiedResult::convert after building the
+// FieldParams, so copy the errorPath instead of moving its parent out from under them.
 FieldParams::FieldParams(SelectionSetParams&& selectionSetParams, response::Value&& directives)
-	: SelectionSetParams(std::move(selectionSetParams))
+	: SelectionSetParams(std::as_const(selectionSetParams))
 	, fieldDirectives(std::move(directives))
 {
 }
@@ -285,7 +400,7 @@ void ValueVisitor::visitFloatValue(const peg::ast_node& floatValue)
 
 void ValueVisitor::visitStringValue(const peg::ast_node& stringValue)
 {
-	_value = response::Value(std::string { stringValue.unescaped_view() });
+	_value = response::Value(stringValue.unescaped());
 }
 
 void ValueVisitor::visitBooleanValue(const peg::ast_node& booleanValue)
@@ -500,6 +615,232 @@ const response::Value& Fragment::getDirectives() const
 	return _directives;
 }
 
+namespace {
+
+// Returns true if the value, or any nested list or object value, references a variable.
+bool hasVariables(const peg::ast_node& value)
+{
+	if (value.is_type<peg::variable_value>())
+	{
+		return true;
+	}
+
+	return std::any_of(value.children.cbegin(), value.children.cend(), [](const auto& child) {
+		return hasVariables(*child);
+	});
+}
+
+response::Value visitArguments(const peg::ast_node& arguments, const response::Value& variables)
+{
+	response::Value result(response::Type::Map);
+	ValueVisitor visitor(variables);
+
+	for (auto& argument : arguments.children)
+	{
+		visitor.visit(*argument->children.back());
+
+		result.emplace_back(argument->children.front()->string(), visitor.getValue());
+	}
+
+	return result;
+}
+
+} // namespace
+
+// FieldPlan holds everything about a field selection which does not depend on the variables or
+// the Object that it's resolved against.
+struct FieldPlan
+{
+	std::string_view name;
+	std::string_view alias;
+	const peg::ast_node* arguments = nullptr;
+	const peg::ast_node* directives = nullptr;
+	const peg::ast_node* selection = nullptr;
+
+	// Arguments and directives which don't reference any variables are only evaluated once.
+	std::optional<response::Value> constantArguments;
+	std::optional<response::Value> constantDirectives;
+	bool skip = false;
+};
+
+namespace {
+
+FieldPlan compileField(const peg::ast_node& field, bool foldConstants)
+{
+	FieldPlan result;
+
+	for (const auto& child : field.children)
+	{
+		if (child->is_type<peg::field_name>())
+		{
+			result.name = child->string_view();
+		}
+		else if (child->is_type<peg::alias_name>())
+		{
+			result.alias = child->string_view();
+		}
+		else if (child->is_type<peg::arguments>())
+		{
+			result.arguments = child.get();
+		}
+		else if (child->is_type<peg::directives>())
+		{
+			result.directives = child.get();
+		}
+		else if (child->is_type<peg::selection_set>())
+		{
+			result.selection = child.get();
+		}
+	}
+
+	if (result.alias.empty())
+	{
+		result.alias = result.name;
+	}
+
+	if (!foldConstants)
+	{
+		return result;
+	}
+
+	const response::Value emptyVariables(response::Type::Map);
+
+	if (result.arguments == nullptr)
+	{
+		result.constantArguments = std::make_optional<response::Value>(response::Type::Map);
+	}
+	else if (!hasVariables(*result.arguments))
+	{
+		result.constantArguments =
+			std::make_optional(visitArguments(*result.arguments, emptyVariables));
+	}
+
+	if (result.directives == nullptr)
+	{
+		result.constantDirectives = std::make_optional<response::Value>(response::Type::Map);
+	}
+	else if (!hasVariables(*result.directives))
+	{
+		try
+		{
+			DirectiveVisitor directiveVisitor(emptyVariables);
+
+			directiveVisitor.visit(*result.directives);
+			result.skip = directiveVisitor.shouldSkip();
+			result.constantDirectives = std::make_optional(directiveVisitor.getDirectives());
+		}
+		catch (const schema_exception&)
+		{
+			// Leave invalid directives to report the error each time the field is resolved.
+		}
+	}
+
+	return result;
+}
+
+} // namespace
+
+// ExecutionPlan is compiled by Request::validate and cached in peg::ast::plan. Subsequent
+// calls to Request::resolve with the same query look up the operation, fragment definitions and
+// field selections here instead of walking the AST.
+struct ExecutionPlan
+{
+	using OperationDefinition = std::pair<std::string_view, const peg::ast_node*>;
+
+	const OperationDefinition* findOperation(std::string_view operationName) const;
+	const FieldPlan* findField(const peg::ast_node& field) const;
+
+	std::vector<std::pair<std::string_view, OperationDefinition>> operations;
+	internal::string_view_map<const peg::ast_node*> fragmentDefinitions;
+	std::unordered_map<const peg::ast_node*, FieldPlan> fields;
+};
+
+const ExecutionPlan::OperationDefinition* ExecutionPlan::findOperation(
+	std::string_view operationName) const
+{
+	const auto itr = std::find_if(operations.cbegin(),
+		operations.cend(),
+		[operationName](const auto& entry) noexcept {
+			return operationName.empty() || entry.first == operationName;
+		});
+
+	return (itr == operations.cend() ? nullptr : &itr->second);
+}
+
+const FieldPlan* ExecutionPlan::findField(const peg::ast_node& field) const
+{
+	const auto itr = fields.find(&field);
+
+	return (itr == fields.cend() ? nullptr : &itr->second);
+}
+
+namespace {
+
+void compileFields(const peg::ast_node& node, ExecutionPlan& plan)
+{
+	if (node.is_type<peg::field>())
+	{
+		plan.fields.emplace(&node, compileField(node, true));
+	}
+
+	for (const auto& child : node.children)
+	{
+		compileFields(*child, plan);
+	}
+}
+
+// Compile the ExecutionPlan for a query which just passed validation.
+std::shared_ptr<const ExecutionPlan> compileExecutionPlan(const peg::ast& query)
+{
+	auto plan = std::make_shared<ExecutionPlan>();
+
+	for (const auto& definition : query.root->children)
+	{
+		if (definition->is_type<peg::operation_definition>())
+		{
+			std::string_view operationType = strQuery;
+			std::string_view name;
+
+			peg::on_first_child<peg::operation_type>(*definition,
+				[&operationType](const peg::ast_node& child) {
+					operationType = child.string_view();
+				});
+
+			peg::on_first_child<peg::operation_name>(*definition,
+				[&name](const peg::ast_node& child) {
+					name = child.string_view();
+				});
+
+			plan->operations.push_back({ name, { operationType, definition.get() } });
+		}
+		else if (definition->is_type<peg::fragment_definition>())
+		{
+			plan->fragmentDefinitions.emplace(definition->children.front()->string_view(),
+				definition.get());
+		}
+
+		compileFields(*definition, *plan);
+	}
+
+	return plan;
+}
+
+FragmentMap buildFragments(const ExecutionPlan& plan, const response::Value& variables)
+{
+	FragmentMap fragments;
+
+	fragments.reserve(plan.fragmentDefinitions.size());
+
+	for (const auto& entry : plan.fragmentDefinitions)
+	{
+		fragments.emplace(entry.first, Fragment(*entry.second, variables));
+	}
+
+	return fragments;
+}
+
+} // namespace
+
 ResolverParams::ResolverParams(const SelectionSetParams& selectionSetParams,
 	const peg::ast_node& field, std::string&& fieldName, response::Value&& arguments,
 	response::Value&& fieldDirectives, const peg::ast_node* selection, const FragmentMap& fragments,
@@ -749,7 +1090,7 @@ void blockSubFields(const ResolverParams& params)
 }
 
 template <>
-std::future<ResolverResult> ModifiedResult<response::IntType>::convert(
+FieldResult<ResolverResult> ModifiedResult<response::IntType>::convert(
 	FieldResult<response::IntType>&& result, ResolverParams&& params)
 {
 	blockSubFields(params);
@@ -762,7 +1103,7 @@ std::future<ResolverResult> ModifiedResult<response::IntType>::convert(
 }
 
 template <>
-std::future<ResolverResult> ModifiedResult<response::FloatType>::convert(
+FieldResult<ResolverResult> ModifiedResult<response::FloatType>::convert(
 	FieldResult<response::FloatType>&& result, ResolverParams&& params)
 {
 	blockSubFields(params);
@@ -775,7 +1116,7 @@ std::future<ResolverResult> ModifiedResult<response::FloatType>::convert(
 }
 
 template <>
-std::future<ResolverResult> ModifiedResult<response::StringType>::convert(
+FieldResult<ResolverResult> ModifiedResult<response::StringType>::convert(
 	FieldResult<response::StringType>&& result, ResolverParams&& params)
 {
 	blockSubFields(params);
@@ -788,7 +1129,7 @@ std::future<ResolverResult> ModifiedResult<response::StringType>::convert(
 }
 
 template <>
-std::future<ResolverResult> ModifiedResult<response::BooleanType>::convert(
+FieldResult<ResolverResult> ModifiedResult<response::BooleanType>::convert(
 	FieldResult<response::BooleanType>&& result, ResolverParams&& params)
 {
 	blockSubFields(params);
@@ -801,7 +1142,7 @@ std::future<ResolverResult> ModifiedResult<response::BooleanType>::convert(
 }
 
 template <>
-std::future<ResolverResult> ModifiedResult<response::Value>::convert(
+FieldResult<ResolverResult> ModifiedResult<response::Value>::convert(
 	FieldResult<response::Value>&& result, ResolverParams&& params)
 {
 	blockSubFields(params);
@@ -814,7 +1155,7 @@ std::future<ResolverResult> ModifiedResult<response::Value>::convert(
 }
 
 template <>
-std::future<ResolverResult> ModifiedResult<response::IdType>::convert(
+FieldResult<ResolverResult> ModifiedResult<response::IdType>::convert(
 	FieldResult<response::IdType>&& result, ResolverParams&& params)
 {
 	blockSubFields(params);
@@ -843,7 +1184,7 @@ void requireSubFields(const ResolverParams& params)
 }
 
 template <>
-std::future<ResolverResult> ModifiedResult<Object>::convert(
+FieldResult<ResolverResult> ModifiedResult<Object>::convert(
 	FieldResult<std::shared_ptr<Object>>&& result, ResolverParams&& params)
 {
 	requireSubFields(params);
@@ -867,17 +1208,49 @@ std::future<ResolverResult> ModifiedResult<Object>::convert(
 
 	if (result.is_future())
 	{
-		return std::async(params.launch,
+#ifdef GRAPHQL_USE_COROUTINES
+		if (result.is_continuable())
+		{
+			return continueResult(std::move(result),
+				[wrappedParams = std::move(params)](
+					FieldResult<std::shared_ptr<Object>>&& wrappedResult) mutable
+				-> FieldResult<ResolverResult> {
+					auto object = wrappedResult.get();
+
+					if (!object)
+					{
+						return ResolverResult {};
+					}
+
+					return object->resolve(wrappedParams,
+						*wrappedParams.selection,
+						wrappedParams.fragments,
+						wrappedParams.variables);
+				});
+		}
+#endif // GRAPHQL_USE_COROUTINES
+
+		const auto launch = params.launch;
+		const auto executor = params.executor;
+
+		return launchAsync(executor,
+			launch,
 			std::move(buildResult),
 			std::move(result),
 			std::move(params));
 	}
 
-	std::promise<ResolverResult> promise;
+	auto wrappedResult = result.get();
 
-	promise.set_value(buildResult(std::move(result), std::move(params)));
+	if (!wrappedResult)
+	{
+		return ResolverResult {};
+	}
 
-	return promise.get_future();
+	// Pass the result through without waiting for it, it's only a future if some of the fields
+	// in the selection set are still pending. Those fields share ownership of their error paths,
+	// and everything else they borrow is owned by the OperationData, so they don't need params.
+	return wrappedResult->resolve(params, *params.selection, params.fragments, params.variables);
 }
 
 // As we recursively expand fragment spreads and inline fragments, we want to accumulate the
@@ -891,51 +1264,258 @@ struct FragmentDirectives
 	response::Value inlineFragmentDirectives;
 };
 
+// A fragment with @defer or an element of a list with @stream, which is delivered in its own
+// payload after the initial result.
+struct IncrementalRecord
+{
+	bool isItem;
+	std::optional<std::string> label;
+	error_path path;
+	FieldResult<ResolverResult> result;
+};
+
+// IncrementalPayloads collects the deferred fragments and streamed list elements while an
+// operation is resolved, and then delivers each of them to the IncrementalCallback after the
+// initial result. They may be added from multiple threads, and resolving one of them may add more.
+class IncrementalPayloads
+{
+public:
+	void push(IncrementalRecord&& record);
+	void deliver(ResolverResult&& initial, const IncrementalCallback& callback);
+
+private:
+	std::optional<IncrementalRecord> pop();
+	bool hasNext();
+
+	std::mutex _mutex;
+	std::list<IncrementalRecord> _records;
+};
+
+void IncrementalPayloads::push(IncrementalRecord&& record)
+{
+	std::lock_guard lock { _mutex };
+
+	_records.push_back(std::move(record));
+}
+
+std::optional<IncrementalRecord> IncrementalPayloads::pop()
+{
+	std::lock_guard lock { _mutex };
+
+	if (_records.empty())
+	{
+		return std::nullopt;
+	}
+
+	auto record = std::make_optional(std::move(_records.front()));
+
+	_records.pop_front();
+
+	return record;
+}
+
+bool IncrementalPayloads::hasNext()
+{
+	std::lock_guard lock { _mutex };
+
+	return !_records.empty();
+}
+
+void IncrementalPayloads::deliver(ResolverResult&& initial, const IncrementalCallback& callback)
+{
+	response::Value document { response::Type::Map };
+
+	document.emplace_back(std::string { strData }, std::move(initial.data));
+
+	if (!initial.errors.empty())
+	{
+		document.emplace_back(std::string { strErrors },
+			buildErrorValues(std::move(initial.errors)));
+	}
+
+	if (!hasNext())
+	{
+		// Nothing was deferred, so this is just a regular result.
+		callback(std::move(document));
+		return;
+	}
+
+	document.emplace_back(std::string { strHasNext }, response::Value(true));
+	callback(std::move(document));
+
+	while (auto record = pop())
+	{
+		ResolverResult result;
+
+		try
+		{
+			result = record->result.get();
+		}
+		catch (schema_exception& scx)
+		{
+			result.errors = scx.getStructuredErrors();
+		}
+		catch (const std::exception& ex)
+		{
+			std::ostringstream message;
+
+			message << "Incremental payload unknown error: " << ex.what();
+
+			result.errors.push_back({ message.str(), {}, record->path });
+		}
+
+		response::Value payload { response::Type::Map };
+
+		if (record->isItem)
+		{
+			response::Value items { response::Type::List };
+
+			items.emplace_back(std::move(result.data));
+			payload.emplace_back(std::string { strItems }, std::move(items));
+		}
+		else
+		{
+			payload.emplace_back(std::string { strData }, std::move(result.data));
+		}
+
+		payload.emplace_back(std::string { strPath }, buildPathValue(record->path));
+
+		if (record->label)
+		{
+			payload.emplace_back(std::string { strLabel },
+				response::Value(std::move(*record->label)));
+		}
+
+		if (!result.errors.empty())
+		{
+			payload.emplace_back(std::string { strErrors },
+				buildErrorValues(std::move(result.errors)));
+		}
+
+		// Resolving this payload may have deferred some more, so check again before delivering it.
+		payload.emplace_back(std::string { strHasNext }, response::Value(hasNext()));
+		callback(std::move(payload));
+	}
+}
+
+// The arguments of an @defer or @stream directive.
+struct IncrementalDirective
+{
+	std::optional<std::string> label;
+	size_t initialCount = 0;
+};
+
+// Find an @defer or @stream directive, unless it's disabled with if: false.
+std::optional<IncrementalDirective> findIncrementalDirective(
+	const response::Value& directives, std::string_view name)
+{
+	const auto itrDirective = directives.find(name);
+
+	if (itrDirective == directives.end() || itrDirective->second.type() != response::Type::Map)
+	{
+		return std::nullopt;
+	}
+
+	IncrementalDirective result;
+
+	for (const auto& argument : itrDirective->second)
+	{
+		if (argument.first == "if"sv && argument.second.type() == response::Type::Boolean
+			&& !argument.second.get<response::BooleanType>())
+		{
+			return std::nullopt;
+		}
+		else if (argument.first == strLabel && argument.second.type() == response::Type::String)
+		{
+			result.label = argument.second.get<response::StringType>();
+		}
+		else if (argument.first == "initialCount"sv
+			&& argument.second.type() == response::Type::Int)
+		{
+			const auto initialCount = argument.second.get<response::IntType>();
+
+			if (initialCount < 0)
+			{
+				std::ostringstream error;
+
+				error << "Invalid argument to directive: " << name << " name: initialCount";
+
+				throw schema_exception { { error.str() } };
+			}
+
+			result.initialCount = static_cast<size_t>(initialCount);
+		}
+	}
+
+	return std::make_optional(std::move(result));
+}
+
+// The state a fragment with @defer needs to resolve its selection set separately, after the rest
+// of the selection set which included it.
+struct DeferredFragment
+{
+	std::shared_ptr<Object> object;
+	const peg::ast_node& selection;
+	FragmentDirectives directives;
+	std::optional<field_path> path;
+};
+
 // SelectionVisitor visits the AST and resolves a field or fragment, unless it's skipped by
 // a directive or type condition.
 class SelectionVisitor
 {
 public:
 	explicit SelectionVisitor(const SelectionSetParams& selectionSetParams,
-		const FragmentMap& fragments, const response::Value& variables, const TypeNames& typeNames,
-		const ResolverMap& resolvers, size_t count);
+		const FragmentMap& fragments, const response::Value& variables, Object& object,
+		const TypeNames& typeNames, const FieldResolverMap& resolvers, size_t count);
 
 	void visit(const peg::ast_node& selection);
 
-	std::vector<std::pair<std::string_view, std::future<ResolverResult>>> getValues();
+	std::vector<std::pair<std::string_view, FieldResult<ResolverResult>>> getValues();
 
 private:
 	void visitField(const peg::ast_node& field);
 	void visitFragmentSpread(const peg::ast_node& fragmentSpread);
 	void visitInlineFragment(const peg::ast_node& inlineFragment);
+	void deferFragment(std::optional<std::string>&& label, const peg::ast_node& selection);
 
 	const ResolverContext _resolverContext;
 	const std::shared_ptr<RequestState>& _state;
 	const response::Value& _operationDirectives;
-	const std::optional<std::reference_wrapper<const field_path>> _path;
+	const std::shared_ptr<const field_path> _path;
 	const std::launch _launch;
+	const std::shared_ptr<Executor>& _executor;
+	const ExecutionPlan* _plan;
+	const bool _streaming;
+	IncrementalPayloads* const _incremental;
 	const FragmentMap& _fragments;
 	const response::Value& _variables;
+	Object& _object;
 	const TypeNames& _typeNames;
-	const ResolverMap& _resolvers;
+	const FieldResolverMap& _resolvers;
 
 	std::list<FragmentDirectives> _fragmentDirectives;
 	internal::string_view_set _names;
-	std::vector<std::pair<std::string_view, std::future<ResolverResult>>> _values;
+	std::vector<std::pair<std::string_view, FieldResult<ResolverResult>>> _values;
 };
 
 SelectionVisitor::SelectionVisitor(const SelectionSetParams& selectionSetParams,
-	const FragmentMap& fragments, const response::Value& variables, const TypeNames& typeNames,
-	const ResolverMap& resolvers, size_t count)
+	const FragmentMap& fragments, const response::Value& variables, Object& object,
+	const TypeNames& typeNames, const FieldResolverMap& resolvers, size_t count)
 	: _resolverContext(selectionSetParams.resolverContext)
 	, _state(selectionSetParams.state)
 	, _operationDirectives(selectionSetParams.operationDirectives)
 	, _path(selectionSetParams.errorPath
-			  ? std::make_optional(std::cref(*selectionSetParams.errorPath))
-			  : std::nullopt)
+			  ? std::make_shared<const field_path>(*selectionSetParams.errorPath)
+			  : nullptr)
 	, _launch(selectionSetParams.launch)
+	, _executor(selectionSetParams.executor)
+	, _plan(selectionSetParams.plan)
+	, _streaming(selectionSetParams.streaming)
+	, _incremental(selectionSetParams.incremental)
 	, _fragments(fragments)
 	, _variables(variables)
+	, _object(object)
 	, _typeNames(typeNames)
 	, _resolvers(resolvers)
 {
@@ -947,7 +1527,7 @@ SelectionVisitor::SelectionVisitor(const SelectionSetParams& selectionSetParams,
 	_values.reserve(count);
 }
 
-std::vector<std::pair<std::string_view, std::future<ResolverResult>>> SelectionVisitor::getValues()
+std::vector<std::pair<std::string_view, FieldResult<ResolverResult>>> SelectionVisitor::getValues()
 {
 	auto values = std::move(_values);
 
@@ -972,23 +1552,18 @@ void SelectionVisitor::visit(const peg::ast_node& selection)
 
 void SelectionVisitor::visitField(const peg::ast_node& field)
 {
-	std::string_view name;
-
-	peg::on_first_child<peg::field_name>(field, [&name](const peg::ast_node& child) {
-		name = child.string_view();
-	});
-
-	std::string_view alias;
+	const FieldPlan* cachedPlan = (_plan ? _plan->findField(field) : nullptr);
+	std::optional<FieldPlan> compiledPlan;
 
-	peg::on_first_child<peg::alias_name>(field, [&alias](const peg::ast_node& child) {
-		alias = child.string_view();
-	});
-
-	if (alias.empty())
+	if (!cachedPlan)
 	{
-		alias = name;
+		compiledPlan = std::make_optional(compileField(field, false));
 	}
 
+	const auto& fieldPlan = (cachedPlan ? *cachedPlan : *compiledPlan);
+	const auto name = fieldPlan.name;
+	const auto alias = fieldPlan.alias;
+
 	if (!_names.emplace(alias).second)
 	{
 		// Skip resolving fields which map to the same response name as a field we've already
@@ -1001,50 +1576,61 @@ void SelectionVisitor::visitField(const peg::ast_node& field)
 
 	if (itrResolver == _resolvers.end())
 	{
-		std::promise<ResolverResult> promise;
 		auto position = field.begin();
 		std::ostringstream error;
 
 		error << "Unknown field name: " << name;
 
-		promise.set_exception(
-			std::make_exception_ptr(schema_exception { { schema_error { error.str(),
-				{ position.line, position.column },
-				buildErrorPath(_path ? std::make_optional(_path->get()) : std::nullopt) } } }));
-
-		_values.push_back({ alias, promise.get_future() });
+		_values.push_back({ alias,
+			ResolverResult { {},
+				{ schema_error { error.str(),
+					{ position.line, position.column },
+					buildErrorPath(_path ? std::make_optional(*_path) : std::nullopt) } } } });
 		return;
 	}
 
-	DirectiveVisitor directiveVisitor(_variables);
+	response::Value fieldDirectives;
 
-	peg::on_first_child<peg::directives>(field, [&directiveVisitor](const peg::ast_node& child) {
-		directiveVisitor.visit(child);
-	});
-
-	if (directiveVisitor.shouldSkip())
+	if (fieldPlan.constantDirectives)
 	{
-		return;
-	}
-
-	response::Value arguments(response::Type::Map);
+		if (fieldPlan.skip)
+		{
+			return;
+		}
 
-	peg::on_first_child<peg::arguments>(field, [this, &arguments](const peg::ast_node& child) {
-		ValueVisitor visitor(_variables);
+		fieldDirectives = response::Value(*fieldPlan.constantDirectives);
+	}
+	else
+	{
+		DirectiveVisitor directiveVisitor(_variables);
 
-		for (auto& argument : child.children)
+		if (fieldPlan.directives)
 		{
-			visitor.visit(*argument->children.back());
+			directiveVisitor.visit(*fieldPlan.directives);
+		}
 
-			arguments.emplace_back(argument->children.front()->string(), visitor.getValue());
+		if (directiveVisitor.shouldSkip())
+		{
+			return;
 		}
-	});
 
-	const peg::ast_node* selection = nullptr;
+		fieldDirectives = directiveVisitor.getDirectives();
+	}
 
-	peg::on_first_child<peg::selection_set>(field, [&selection](const peg::ast_node& child) {
-		selection = &child;
-	});
+	response::Value arguments;
+
+	if (fieldPlan.constantArguments)
+	{
+		arguments = response::Value(*fieldPlan.constantArguments);
+	}
+	else if (fieldPlan.arguments)
+	{
+		arguments = visitArguments(*fieldPlan.arguments, _variables);
+	}
+	else
+	{
+		arguments = response::Value(response::Type::Map);
+	}
 
 	const SelectionSetParams selectionSetParams {
 		_resolverContext,
@@ -1055,24 +1641,28 @@ void SelectionVisitor::visitField(const peg::ast_node& field)
 		_fragmentDirectives.back().inlineFragmentDirectives,
 		std::make_optional(field_path { _path, path_segment { alias } }),
 		_launch,
+		_executor,
+		_plan,
+		_streaming,
+		_incremental,
 	};
 
 	try
 	{
-		auto result = itrResolver->second(ResolverParams(selectionSetParams,
-			field,
-			std::string(alias),
-			std::move(arguments),
-			directiveVisitor.getDirectives(),
-			selection,
-			_fragments,
-			_variables));
+		auto result = itrResolver->second(_object,
+			ResolverParams(selectionSetParams,
+				field,
+				std::string(alias),
+				std::move(arguments),
+				std::move(fieldDirectives),
+				fieldPlan.selection,
+				_fragments,
+				_variables));
 
 		_values.push_back({ alias, std::move(result) });
 	}
 	catch (schema_exception& scx)
 	{
-		std::promise<ResolverResult> promise;
 		auto position = field.begin();
 		auto messages = scx.getStructuredErrors();
 
@@ -1089,24 +1679,20 @@ void SelectionVisitor::visitField(const peg::ast_node& field)
 			}
 		}
 
-		promise.set_exception(std::make_exception_ptr(schema_exception { std::move(messages) }));
-
-		_values.push_back({ alias, promise.get_future() });
+		_values.push_back({ alias, ResolverResult { {}, std::move(messages) } });
 	}
 	catch (const std::exception& ex)
 	{
-		std::promise<ResolverResult> promise;
 		auto position = field.begin();
 		std::ostringstream message;
 
 		message << "Field error name: " << alias << " unknown error: " << ex.what();
 
-		promise.set_exception(
-			std::make_exception_ptr(schema_exception { { schema_error { message.str(),
-				{ position.line, position.column },
-				buildErrorPath(selectionSetParams.errorPath) } } }));
-
-		_values.push_back({ alias, promise.get_future() });
+		_values.push_back({ alias,
+			ResolverResult { {},
+				{ schema_error { message.str(),
+					{ position.line, position.column },
+					buildErrorPath(selectionSetParams.errorPath) } } } });
 	}
 }
 
@@ -1124,7 +1710,7 @@ void SelectionVisitor::visitFragmentSpread(const peg::ast_node& fragmentSpread)
 
 		throw schema_exception { { schema_error { error.str(),
 			{ position.line, position.column },
-			buildErrorPath(_path ? std::make_optional(_path->get()) : std::nullopt) } } };
+			buildErrorPath(_path ? std::make_optional(*_path) : std::nullopt) } } };
 	}
 
 	bool skip = (_typeNames.find(itr->second.getType()) == _typeNames.end());
@@ -1146,6 +1732,8 @@ void SelectionVisitor::visitFragmentSpread(const peg::ast_node& fragmentSpread)
 	}
 
 	auto fragmentSpreadDirectives = directiveVisitor.getDirectives();
+	auto defer = (_incremental ? findIncrementalDirective(fragmentSpreadDirectives, strDefer)
+							   : std::nullopt);
 
 	// Merge outer fragment spread directives as long as they don't conflict.
 	for (const auto& entry : _fragmentDirectives.back().fragmentSpreadDirectives)
@@ -1173,6 +1761,13 @@ void SelectionVisitor::visitFragmentSpread(const peg::ast_node& fragmentSpread)
 		std::move(fragmentSpreadDirectives),
 		response::Value(_fragmentDirectives.back().inlineFragmentDirectives) });
 
+	if (defer)
+	{
+		deferFragment(std::move(defer->label), itr->second.getSelection());
+		_fragmentDirectives.pop_back();
+		return;
+	}
+
 	const size_t count = itr->second.getSelection().children.size();
 
 	if (count > 1)
@@ -1216,6 +1811,9 @@ void SelectionVisitor::visitInlineFragment(const peg::ast_node& inlineFragment)
 		peg::on_first_child<peg::selection_set>(inlineFragment,
 			[this, &directiveVisitor](const peg::ast_node& child) {
 				auto inlineFragmentDirectives = directiveVisitor.getDirectives();
+				auto defer = (_incremental
+						? findIncrementalDirective(inlineFragmentDirectives, strDefer)
+						: std::nullopt);
 
 				// Merge outer inline fragment directives as long as they don't conflict.
 				for (const auto& entry : _fragmentDirectives.back().inlineFragmentDirectives)
@@ -1233,6 +1831,13 @@ void SelectionVisitor::visitInlineFragment(const peg::ast_node& inlineFragment)
 						response::Value(_fragmentDirectives.back().fragmentSpreadDirectives),
 						std::move(inlineFragmentDirectives) });
 
+				if (defer)
+				{
+					deferFragment(std::move(defer->label), child);
+					_fragmentDirectives.pop_back();
+					return;
+				}
+
 				const size_t count = child.children.size();
 
 				if (count > 1)
@@ -1251,35 +1856,314 @@ void SelectionVisitor::visitInlineFragment(const peg::ast_node& inlineFragment)
 	}
 }
 
-Object::Object(TypeNames&& typeNames, ResolverMap&& resolvers)
-	: _typeNames(std::move(typeNames))
-	, _resolvers(std::move(resolvers))
+void SelectionVisitor::deferFragment(
+	std::optional<std::string>&& label, const peg::ast_node& selection)
+{
+	auto path = buildErrorPath(_path ? std::make_optional(*_path) : std::nullopt);
+	auto fragment = std::make_shared<DeferredFragment>(DeferredFragment { _object.shared_from_this(),
+		selection,
+		_fragmentDirectives.back(),
+		_path ? std::make_optional(*_path) : std::nullopt });
+
+	// Start resolving the fragment right away if it's launched asynchronously, but the result is
+	// only delivered after the initial result.
+	auto result = launchAsync(
+		_executor,
+		_launch,
+		[fragment = std::move(fragment),
+			resolverContext = _resolverContext,
+			&state = _state,
+			&operationDirectives = _operationDirectives,
+			launch = _launch,
+			executor = _executor,
+			plan = _plan,
+			incremental = _incremental,
+			&fragments = _fragments,
+			&variables = _variables]() {
+			const SelectionSetParams selectionSetParams {
+				resolverContext,
+				state,
+				operationDirectives,
+				fragment->directives.fragmentDefinitionDirectives,
+				fragment->directives.fragmentSpreadDirectives,
+				fragment->directives.inlineFragmentDirectives,
+				fragment->path,
+				launch,
+				executor,
+				plan,
+				false,
+				incremental,
+			};
+
+			return fragment->object
+				->resolve(selectionSetParams, fragment->selection, fragments, variables)
+				.get();
+		});
+
+	_incremental->push({ false, std::move(label), std::move(path), std::move(result) });
+}
+
+PendingResult::~PendingResult() = default;
+
+void writeResult(ResolverResult&& result, response::Writer& writer, std::list<schema_error>& errors)
+{
+	if (!result.errors.empty())
+	{
+		errors.splice(errors.end(), result.errors);
+	}
+
+	if (result.pending)
+	{
+		result.pending->write(writer, errors);
+	}
+	else
+	{
+		writer.write(std::move(result.data));
+	}
+}
+
+// The fields of a selection set which is being written to a response::Writer. Each of them is
+// written as soon as its result is available, in the same order as Object::resolve would join them.
+class PendingObject : public PendingResult
+{
+public:
+	explicit PendingObject(
+		std::vector<std::pair<std::string_view, FieldResult<ResolverResult>>>&& children)
+		: _children { std::move(children) }
+	{
+	}
+
+	void write(response::Writer& writer, std::list<schema_error>& errors) override
+	{
+		writer.start_object();
+
+		for (auto& child : _children)
+		{
+			const auto name = child.first;
+
+			try
+			{
+				auto value = child.second.get();
+
+				writer.add_member(name);
+				writeResult(std::move(value), writer, errors);
+			}
+			catch (schema_exception& scx)
+			{
+				auto messages = scx.getStructuredErrors();
+
+				errors.splice(errors.end(), messages);
+				writer.add_member(name);
+				writer.write_null();
+			}
+			catch (const std::exception& ex)
+			{
+				std::ostringstream message;
+
+				message << "Field error name: " << name << " unknown error: " << ex.what();
+
+				errors.push_back({ message.str() });
+				writer.add_member(name);
+				writer.write_null();
+			}
+		}
+
+		writer.end_object();
+	}
+
+private:
+	std::vector<std::pair<std::string_view, FieldResult<ResolverResult>>> _children;
+};
+
+// The elements of a list which is being written to a response::Writer, which are handled the same
+// way as ModifiedResult::joinList.
+class PendingList : public PendingResult
+{
+public:
+	explicit PendingList(
+		std::vector<FieldResult<ResolverResult>>&& children, ResolverParams&& params)
+		: _children(std::move(children))
+		, _params { std::move(params) }
+	{
+	}
+
+	void write(response::Writer& writer, std::list<schema_error>& errors) override
+	{
+		std::get<size_t>(_params.errorPath->segment) = 0;
+		writer.start_list();
+
+		for (auto& child : _children)
+		{
+			try
+			{
+				writeResult(child.get(), writer, errors);
+			}
+			catch (schema_exception& scx)
+			{
+				auto messages = scx.getStructuredErrors();
+
+				errors.splice(errors.end(), messages);
+			}
+			catch (const std::exception& ex)
+			{
+				std::ostringstream message;
+
+				message << "Field error name: " << _params.fieldName
+						<< " unknown error: " << ex.what();
+
+				errors.emplace_back(schema_error { message.str(),
+					_params.getLocation(),
+					buildErrorPath(_params.errorPath) });
+			}
+
+			++std::get<size_t>(_params.errorPath->segment);
+		}
+
+		writer.end_list();
+	}
+
+private:
+	std::vector<FieldResult<ResolverResult>> _children;
+	ResolverParams _params;
+};
+
+ResolverResult deferList(
+	std::vector<FieldResult<ResolverResult>>&& children, ResolverParams&& params)
+{
+	return { {}, {}, std::make_unique<PendingList>(std::move(children), std::move(params)) };
+}
+
+void streamList(std::vector<FieldResult<ResolverResult>>& children, const ResolverParams& params,
+	const std::optional<field_path>& path)
+{
+	// Only the outermost list of a field with nested list modifiers is streamed.
+	if (!params.incremental || !path || !std::holds_alternative<std::string_view>(path->segment))
+	{
+		return;
+	}
+
+	// The generated resolvers move the fieldDirectives into the FieldParams for the accessor, so
+	// visit them again in the AST.
+	DirectiveVisitor directiveVisitor(params.variables);
+
+	peg::on_first_child<peg::directives>(params.field,
+		[&directiveVisitor](const peg::ast_node& child) {
+			directiveVisitor.visit(child);
+		});
+
+	auto stream = findIncrementalDirective(directiveVisitor.getDirectives(), strStream);
+
+	if (!stream || children.size() <= stream->initialCount)
+	{
+		return;
+	}
+
+	const auto fieldPath = buildErrorPath(path);
+	auto itr = children.begin() + stream->initialCount;
+
+	for (size_t index = stream->initialCount; itr != children.end(); ++itr, ++index)
+	{
+		auto itemPath = fieldPath;
+
+		itemPath.push_back(path_segment { index });
+		params.incremental->push({ true, stream->label, std::move(itemPath), std::move(*itr) });
+	}
+
+	children.erase(children.begin() + stream->initialCount, children.end());
+}
+
+// Write the response document for an operation, followed by all of the errors which were
+// collected while writing the data.
+void writeDocument(ResolverResult&& result, response::Writer& writer)
+{
+	std::list<schema_error> errors;
+
+	writer.start_object();
+	writer.add_member(strData);
+	writeResult(std::move(result), writer, errors);
+
+	if (!errors.empty())
+	{
+		writer.add_member(strErrors);
+		writer.write(buildErrorValues(std::move(errors)));
+	}
+
+	writer.end_object();
+}
+
+Object::Object(
+	const TypeNames& typeNames, const FieldResolverMap& resolvers, bool threadSafe) noexcept
+	: _typeNames(typeNames)
+	, _resolvers(resolvers)
+	, _threadSafe(threadSafe)
+{
+}
+
+Object::Object(TypeNames&& typeNames, ResolverMap&& resolvers)
+	: _owned(std::make_unique<OwnedResolvers>(
+		OwnedResolvers { std::move(typeNames), std::move(resolvers), {} }))
+	, _typeNames(_owned->typeNames)
+	, _resolvers(_owned->dispatch)
+	, _threadSafe(false)
+{
+	_owned->dispatch.reserve(_owned->resolvers.size());
+
+	for (const auto& entry : _owned->resolvers)
+	{
+		_owned->dispatch.emplace(entry.first, &Object::resolveOwnedField);
+	}
+}
+
+FieldResult<ResolverResult> Object::resolveOwnedField(Object& object, ResolverParams&& params)
 {
+	std::string_view name;
+
+	peg::on_first_child<peg::field_name>(params.field, [&name](const peg::ast_node& child) {
+		name = child.string_view();
+	});
+
+	// The dispatch table has the same keys as the owned resolvers, so this always finds it.
+	const auto itr = object._owned->resolvers.find(name);
+
+	return itr->second(std::move(params));
 }
 
-std::future<ResolverResult> Object::resolve(const SelectionSetParams& selectionSetParams,
-	const peg::ast_node& selection, const FragmentMap& fragments,
-	const response::Value& variables) const
+FieldResult<ResolverResult> Object::resolve(const SelectionSetParams& selectionSetParams,
+	const peg::ast_node& selection, const FragmentMap& fragments, const response::Value& variables)
 {
 	SelectionVisitor visitor(selectionSetParams,
 		fragments,
 		variables,
+		*this,
 		_typeNames,
 		_resolvers,
 		selection.children.size());
 
 	beginSelectionSet(selectionSetParams);
 
-	for (const auto& child : selection.children)
 	{
-		visitor.visit(*child);
+		// Dispatch the keys which the accessors queued in any DataLoader after visiting all of them.
+		BatchScope batchScope { selectionSetParams.state };
+
+		for (const auto& child : selection.children)
+		{
+			visitor.visit(*child);
+		}
 	}
 
 	endSelectionSet(selectionSetParams);
 
-	return std::async(
-		selectionSetParams.launch,
-		[](std::vector<std::pair<std::string_view, std::future<ResolverResult>>>&& children) {
+	auto values = visitor.getValues();
+
+	if (selectionSetParams.streaming)
+	{
+		// Hand back the results without waiting for any of them, the parent will write them once
+		// it gets to this selection set.
+		return ResolverResult { {}, {}, std::make_unique<PendingObject>(std::move(values)) };
+	}
+
+	auto buildResult =
+		[](std::vector<std::pair<std::string_view, FieldResult<ResolverResult>>>&& children) {
 			ResolverResult document { response::Value { response::Type::Map } };
 
 			document.data.reserve(children.size());
@@ -1331,8 +2215,48 @@ std::future<ResolverResult> Object::resolve(const SelectionSetParams& selectionS
 			}
 
 			return document;
+		};
+
+	if (std::any_of(values.cbegin(), values.cend(), [](const auto& value) noexcept {
+			return value.second.is_future();
+		}))
+	{
+#ifdef GRAPHQL_USE_COROUTINES
+		if (std::all_of(values.cbegin(), values.cend(), [](const auto& value) noexcept {
+				return value.second.is_continuable();
+			}))
+		{
+			return joinResults(std::move(values), std::move(buildResult));
+		}
+#endif // GRAPHQL_USE_COROUTINES
+
+		return launchAsync(selectionSetParams.executor,
+			selectionSetParams.launch,
+			std::move(buildResult),
+			std::move(values));
+	}
+
+	// All of the fields are already resolved, so we can build the result without launching another
+	// task or allocating the shared state for a std::future.
+	return buildResult(std::move(values));
+}
+
+std::future<ResolverResult> Object::resolve(const SelectionSetParams& selectionSetParams,
+	const peg::ast_node& selection, const FragmentMap& fragments,
+	const response::Value& variables) const
+{
+	// The generated resolvers need a non-const Object to lock the _resolverMutex.
+	auto result = const_cast<Object&>(*this).resolve(selectionSetParams,
+		selection,
+		fragments,
+		variables);
+
+	return std::async(
+		std::launch::deferred,
+		[](FieldResult<ResolverResult>&& wrappedResult) {
+			return wrappedResult.get();
 		},
-		visitor.getValues());
+		std::move(result));
 }
 
 bool Object::matchesType(std::string_view typeName) const
@@ -1340,6 +2264,21 @@ bool Object::matchesType(std::string_view typeName) const
 	return _typeNames.find(typeName) != _typeNames.end();
 }
 
+bool Object::isThreadSafe() const noexcept
+{
+	return _threadSafe;
+}
+
+std::unique_lock<std::mutex> Object::lockResolver()
+{
+	if (_threadSafe)
+	{
+		return std::unique_lock<std::mutex> { _resolverMutex, std::defer_lock };
+	}
+
+	return std::unique_lock<std::mutex> { _resolverMutex };
+}
+
 void Object::beginSelectionSet(const SelectionSetParams&) const
 {
 }
@@ -1397,8 +2336,10 @@ class OperationDefinitionVisitor
 {
 public:
 	OperationDefinitionVisitor(ResolverContext resolverContext, std::launch launch,
-		std::shared_ptr<RequestState> state, const TypeMap& operations, response::Value&& variables,
-		FragmentMap&& fragments);
+		const std::shared_ptr<Executor>& executor, peg::ast query, std::shared_ptr<RequestState> state,
+		const TypeMap& operations, response::Value&& variables,
+		FragmentMap&& fragments, response::Writer* writer = nullptr,
+		IncrementalCallback&& incremental = {});
 
 	std::future<ResolverResult> getValue();
 
@@ -1407,19 +2348,28 @@ public:
 private:
 	const ResolverContext _resolverContext;
 	const std::launch _launch;
+	const std::shared_ptr<Executor> _executor;
+	peg::ast _query;
 	std::shared_ptr<OperationData> _params;
 	const TypeMap& _operations;
+	response::Writer* const _writer;
+	IncrementalCallback _incremental;
 	std::future<ResolverResult> _result;
 };
 
 OperationDefinitionVisitor::OperationDefinitionVisitor(ResolverContext resolverContext,
-	std::launch launch, std::shared_ptr<RequestState> state, const TypeMap& operations,
-	response::Value&& variables, FragmentMap&& fragments)
+	std::launch launch, const std::shared_ptr<Executor>& executor, peg::ast query,
+	std::shared_ptr<RequestState> state, const TypeMap& operations, response::Value&& variables, FragmentMap&& fragments,
+	response::Writer* writer, IncrementalCallback&& incremental)
 	: _resolverContext(resolverContext)
 	, _launch(launch)
+	, _executor(executor)
+	, _query(std::move(query))
 	, _params(std::make_shared<OperationData>(
 		  std::move(state), std::move(variables), response::Value(), std::move(fragments)))
 	, _operations(operations)
+	, _writer(writer)
+	, _incremental(std::move(incremental))
 {
 }
 
@@ -1483,16 +2433,30 @@ void OperationDefinitionVisitor::visit(
 
 	_params->directives = std::move(operationDirectives);
 
-	// Keep the params alive until the deferred lambda has executed
-	_result = std::async(
+	// Keep the params and the AST alive until the deferred lambda has executed. The copy of the
+	// peg::ast shares ownership of the input, the nodes, and the plan, so the caller may release
+	// its own copy before the result is ready.
+	_result = launchAsync(
+		_executor,
 		_launch,
 		[selectionContext = _resolverContext,
 			selectionLaunch = _launch,
+			selectionExecutor = _executor,
+			selectionQuery = std::move(_query),
+			selectionWriter = _writer,
+			selectionCallback = std::move(_incremental),
 			params = std::move(_params),
 			operation = itr->second](const peg::ast_node& selection) {
 			// The top level object doesn't come from inside of a fragment, so all of the fragment
 			// directives are empty.
 			const response::Value emptyFragmentDirectives(response::Type::Map);
+			std::optional<IncrementalPayloads> incremental;
+
+			if (selectionCallback)
+			{
+				incremental.emplace();
+			}
+
 			const SelectionSetParams selectionSetParams {
 				selectionContext,
 				params->state,
@@ -1502,11 +2466,35 @@ void OperationDefinitionVisitor::visit(
 				emptyFragmentDirectives,
 				std::nullopt,
 				selectionLaunch,
+				selectionExecutor,
+				selectionQuery.plan.get(),
+				selectionWriter != nullptr,
+				incremental ? &*incremental : nullptr,
 			};
 
-			return operation
-				->resolve(selectionSetParams, selection, params->fragments, params->variables)
-				.get();
+			auto result = operation
+							  ->resolve(selectionSetParams,
+								  selection,
+								  params->fragments,
+								  params->variables)
+							  .get();
+
+			if (selectionWriter)
+			{
+				// The pending results still depend on the OperationData, so they need to be
+				// written before it's released.
+				writeDocument(std::move(result), *selectionWriter);
+				return ResolverResult {};
+			}
+			else if (incremental)
+			{
+				// The deferred payloads are resolved after the initial result is delivered, so
+				// they also need the OperationData.
+				incremental->deliver(std::move(result), selectionCallback);
+				return ResolverResult {};
+			}
+
+			return result;
 		},
 		std::cref(*operationDefinition.children.back()));
 }
@@ -1748,7 +2736,7 @@ void SubscriptionDefinitionVisitor::visitInlineFragment(const peg::ast_node& inl
 
 Request::Request(TypeMap&& operationTypes, const std::shared_ptr<schema::Schema>& schema)
 	: _operations(std::move(operationTypes))
-	, _validation(std::make_unique<ValidateExecutableVisitor>(schema))
+	, _validation(std::make_unique<ValidationContext>(schema))
 {
 }
 
@@ -1756,18 +2744,44 @@ Request::~Request()
 {
 	// The default implementation is fine, but it can't be declared as = default because it needs to
 	// know how to destroy the _validation member and it can't do that with just a forward
-	// declaration of the class.
+	// declaration of the struct.
 }
 
 std::list<schema_error> Request::validate(peg::ast& query) const
 {
 	std::list<schema_error> errors;
 
-	if (!query.validated)
+	if (!query.validated && query.hasTypeSystemDefinitions && !query.hasExecutableDefinitions)
+	{
+		// There's nothing to execute, so report each of the type system definitions which the
+		// parser found without applying any of the other validation rules.
+		for (const auto& child : query.root->children)
+		{
+			auto position = child->begin();
+
+			errors.push_back({ "Unexpected type definition", { position.line, position.column } });
+		}
+	}
+	else if (!query.validated)
+	{
+		ValidateExecutableVisitor visitor { *_validation };
+
+		visitor.visit(*query.root);
+		errors = visitor.getStructuredErrors();
+
+		if (errors.empty())
+		{
+			// Compile the plan before marking the query as validated. Resolving a validated query
+			// only reads the plan, so it's safe to resolve the same query on several threads.
+			query.plan = compileExecutionPlan(query);
+			query.validated = true;
+		}
+	}
+	else if (!query.plan)
 	{
-		_validation->visit(*query.root);
-		errors = _validation->getStructuredErrors();
-		query.validated = errors.empty();
+		// The caller marked the query as validated without calling Request::validate, so it
+		// doesn't have a plan yet. Compile it now, everything else assumes it's there.
+		query.plan = compileExecutionPlan(query);
 	}
 
 	return errors;
@@ -1784,34 +2798,14 @@ std::pair<std::string_view, const peg::ast_node*> Request::findOperationDefiniti
 		throw schema_exception { std::move(errors) };
 	}
 
-	std::pair<std::string_view, const peg::ast_node*> result = { {}, nullptr };
-
-	peg::on_first_child_if<peg::operation_definition>(*query.root,
-		[this, &operationName, &result](const peg::ast_node& operationDefinition) noexcept -> bool {
-			std::string_view operationType = strQuery;
-
-			peg::on_first_child<peg::operation_type>(operationDefinition,
-				[&operationType](const peg::ast_node& child) {
-					operationType = child.string_view();
-				});
-
-			std::string_view name;
-
-			peg::on_first_child<peg::operation_name>(operationDefinition,
-				[&name](const peg::ast_node& child) {
-					name = child.string_view();
-				});
-
-			if (operationName.empty() || name == operationName)
-			{
-				result = { operationType, &operationDefinition };
-				return true;
-			}
+	const auto operationDefinition = query.plan->findOperation(operationName);
 
-			return false;
-		});
+	if (!operationDefinition)
+	{
+		return { {}, nullptr };
+	}
 
-	return result;
+	return *operationDefinition;
 }
 
 std::future<response::Value> Request::resolve(const std::shared_ptr<RequestState>& state,
@@ -1824,94 +2818,256 @@ std::future<response::Value> Request::resolve(std::launch launch,
 	const std::shared_ptr<RequestState>& state, peg::ast& query, const std::string& operationName,
 	response::Value&& variables) const
 {
-	try
-	{
-		FragmentDefinitionVisitor fragmentVisitor(variables);
-
-		peg::for_each_child<peg::fragment_definition>(*query.root,
-			[&fragmentVisitor](const peg::ast_node& child) {
-				fragmentVisitor.visit(child);
-			});
+	return resolve(launch, nullptr, state, query, operationName, std::move(variables));
+}
 
-		auto fragments = fragmentVisitor.getFragments();
-		auto operationDefinition = findOperationDefinition(query, operationName);
+std::future<response::Value> Request::resolve(const std::shared_ptr<Executor>& executor,
+	const std::shared_ptr<RequestState>& state, peg::ast& query, const std::string& operationName,
+	response::Value&& variables) const
+{
+	return resolve(std::launch::async, executor, state, query, operationName, std::move(variables));
+}
 
-		if (!operationDefinition.second)
-		{
-			std::ostringstream message;
+std::future<response::Value> Request::resolve(std::launch launch,
+	const std::shared_ptr<Executor>& executor, const std::shared_ptr<RequestState>& state,
+	peg::ast& query, const std::string& operationName, response::Value&& variables) const
+{
+	try
+	{
+		auto buildDocument = [](std::future<ResolverResult>&& operationFuture) {
+			auto result = operationFuture.get();
+			response::Value document { response::Type::Map };
 
-			message << "Missing operation";
+			document.emplace_back(std::string { strData }, std::move(result.data));
 
-			if (!operationName.empty())
+			if (!result.errors.empty())
 			{
-				message << " name: " << operationName;
+				document.emplace_back(std::string { strErrors },
+					buildErrorValues(std::move(result.errors)));
 			}
 
-			throw schema_exception { { message.str() } };
-		}
-		else if (operationDefinition.first == strSubscription)
+			return document;
+		};
+		auto operationFuture = resolveOperation(launch,
+			executor,
+			state,
+			query,
+			operationName,
+			std::move(variables),
+			nullptr,
+			{});
+
+		if (executor && (launch & std::launch::async) == std::launch::async)
 		{
-			auto position = operationDefinition.second->begin();
-			std::ostringstream message;
+			// The caller is usually not one of the Executor worker threads, so rather than deferring
+			// the result until it waits, start resolving the operation right away.
+			return postTask(executor, std::move(buildDocument), std::move(operationFuture));
+		}
 
-			message << "Unexpected subscription";
+		return std::async(launch, std::move(buildDocument), std::move(operationFuture));
+	}
+	catch (schema_exception& ex)
+	{
+		std::promise<response::Value> promise;
+		response::Value document(response::Type::Map);
 
-			if (!operationName.empty())
-			{
-				message << " name: " << operationName;
-			}
+		document.emplace_back(std::string { strData }, response::Value());
+		document.emplace_back(std::string { strErrors }, ex.getErrors());
+		promise.set_value(std::move(document));
 
-			throw schema_exception {
-				{ schema_error { message.str(), { position.line, position.column } } }
-			};
-		}
+		return promise.get_future();
+	}
+}
 
-		const bool isMutation = (operationDefinition.first == strMutation);
-		const auto resolverContext =
-			isMutation ? ResolverContext::Mutation : ResolverContext::Query;
-		// http://spec.graphql.org/June2018/#sec-Normal-and-Serial-Execution
-		const auto operationLaunch = isMutation ? std::launch::deferred : launch;
+std::future<void> Request::resolve(std::launch launch, const std::shared_ptr<RequestState>& state,
+	peg::ast& query, const std::string& operationName, response::Value&& variables,
+	response::Writer& writer) const
+{
+	return resolve(launch, nullptr, state, query, operationName, std::move(variables), writer);
+}
 
-		OperationDefinitionVisitor operationVisitor(resolverContext,
-			operationLaunch,
+std::future<void> Request::resolve(const std::shared_ptr<Executor>& executor,
+	const std::shared_ptr<RequestState>& state, peg::ast& query, const std::string& operationName,
+	response::Value&& variables, response::Writer& writer) const
+{
+	return resolve(std::launch::async,
+		executor,
+		state,
+		query,
+		operationName,
+		std::move(variables),
+		writer);
+}
+
+std::future<void> Request::resolve(std::launch launch, const std::shared_ptr<Executor>& executor,
+	const std::shared_ptr<RequestState>& state, peg::ast& query, const std::string& operationName,
+	response::Value&& variables, response::Writer& writer) const
+{
+	try
+	{
+		// The operation writes the document from inside its own task, so all that's left is to wait
+		// for it and re-throw any exception.
+		auto waitForDocument = [](std::future<ResolverResult>&& operationFuture) {
+			operationFuture.get();
+		};
+		auto operationFuture = resolveOperation(launch,
+			executor,
 			state,
-			_operations,
+			query,
+			operationName,
 			std::move(variables),
-			std::move(fragments));
+			&writer,
+			{});
 
-		operationVisitor.visit(operationDefinition.first, *operationDefinition.second);
+		if (executor && (launch & std::launch::async) == std::launch::async)
+		{
+			return postTask(executor, std::move(waitForDocument), std::move(operationFuture));
+		}
 
-		return std::async(
-			launch,
-			[](std::future<ResolverResult>&& operationFuture) {
-				auto result = operationFuture.get();
-				response::Value document { response::Type::Map };
+		return std::async(launch, std::move(waitForDocument), std::move(operationFuture));
+	}
+	catch (schema_exception& ex)
+	{
+		std::promise<void> promise;
 
-				document.emplace_back(std::string { strData }, std::move(result.data));
+		writer.start_object();
+		writer.add_member(strData);
+		writer.write_null();
+		writer.add_member(strErrors);
+		writer.write(ex.getErrors());
+		writer.end_object();
+		promise.set_value();
 
-				if (!result.errors.empty())
-				{
-					document.emplace_back(std::string { strErrors },
-						buildErrorValues(std::move(result.errors)));
-				}
+		return promise.get_future();
+	}
+}
 
-				return document;
-			},
-			operationVisitor.getValue());
+std::future<void> Request::resolve(std::launch launch, const std::shared_ptr<RequestState>& state,
+	peg::ast& query, const std::string& operationName, response::Value&& variables,
+	IncrementalCallback&& callback) const
+{
+	return resolve(launch,
+		nullptr,
+		state,
+		query,
+		operationName,
+		std::move(variables),
+		std::move(callback));
+}
+
+std::future<void> Request::resolve(const std::shared_ptr<Executor>& executor,
+	const std::shared_ptr<RequestState>& state, peg::ast& query, const std::string& operationName,
+	response::Value&& variables, IncrementalCallback&& callback) const
+{
+	return resolve(std::launch::async,
+		executor,
+		state,
+		query,
+		operationName,
+		std::move(variables),
+		std::move(callback));
+}
+
+std::future<void> Request::resolve(std::launch launch, const std::shared_ptr<Executor>& executor,
+	const std::shared_ptr<RequestState>& state, peg::ast& query, const std::string& operationName,
+	response::Value&& variables, IncrementalCallback&& callback) const
+{
+	try
+	{
+		// The operation delivers all of the payloads from inside its own task, so all that's left
+		// is to wait for it and re-throw any exception.
+		auto waitForPayloads = [](std::future<ResolverResult>&& operationFuture) {
+			operationFuture.get();
+		};
+		auto operationFuture = resolveOperation(launch,
+			executor,
+			state,
+			query,
+			operationName,
+			std::move(variables),
+			nullptr,
+			IncrementalCallback { callback });
+
+		if (executor && (launch & std::launch::async) == std::launch::async)
+		{
+			return postTask(executor, std::move(waitForPayloads), std::move(operationFuture));
+		}
+
+		return std::async(launch, std::move(waitForPayloads), std::move(operationFuture));
 	}
 	catch (schema_exception& ex)
 	{
-		std::promise<response::Value> promise;
+		std::promise<void> promise;
 		response::Value document(response::Type::Map);
 
 		document.emplace_back(std::string { strData }, response::Value());
 		document.emplace_back(std::string { strErrors }, ex.getErrors());
-		promise.set_value(std::move(document));
+		callback(std::move(document));
+		promise.set_value();
 
 		return promise.get_future();
 	}
 }
 
+std::future<ResolverResult> Request::resolveOperation(std::launch launch,
+	const std::shared_ptr<Executor>& executor, const std::shared_ptr<RequestState>& state,
+	peg::ast& query, const std::string& operationName, response::Value&& variables,
+	response::Writer* writer, IncrementalCallback&& callback) const
+{
+	auto operationDefinition = findOperationDefinition(query, operationName);
+
+	if (!operationDefinition.second)
+	{
+		std::ostringstream message;
+
+		message << "Missing operation";
+
+		if (!operationName.empty())
+		{
+			message << " name: " << operationName;
+		}
+
+		throw schema_exception { { message.str() } };
+	}
+	else if (operationDefinition.first == strSubscription)
+	{
+		auto position = operationDefinition.second->begin();
+		std::ostringstream message;
+
+		message << "Unexpected subscription";
+
+		if (!operationName.empty())
+		{
+			message << " name: " << operationName;
+		}
+
+		throw schema_exception {
+			{ schema_error { message.str(), { position.line, position.column } } }
+		};
+	}
+
+	const bool isMutation = (operationDefinition.first == strMutation);
+	const auto resolverContext = isMutation ? ResolverContext::Mutation : ResolverContext::Query;
+	// http://spec.graphql.org/June2018/#sec-Normal-and-Serial-Execution
+	const auto operationLaunch = isMutation ? std::launch::deferred : launch;
+	auto fragments = buildFragments(*query.plan, variables);
+
+	OperationDefinitionVisitor operationVisitor(resolverContext,
+		operationLaunch,
+		isMutation ? nullptr : executor,
+		query,
+		state,
+		_operations,
+		std::move(variables),
+		std::move(fragments),
+		writer,
+		std::move(callback));
+
+	operationVisitor.visit(operationDefinition.first, *operationDefinition.second);
+
+	return operationVisitor.getValue();
+}
+
 std::pair<std::string, const peg::ast_node*> Request::findOperationDefinition(
 	const peg::ast_node& root, const std::string& operationName) const
 {
@@ -2028,6 +3184,8 @@ std::future<response::Value> Request::resolveUnvalidated(std::launch launch,
 
 		OperationDefinitionVisitor operationVisitor(resolverContext,
 			launch,
+			nullptr,
+			peg::ast {},
 			state,
 			_operations,
 			std::move(variables),
@@ -2075,15 +3233,8 @@ SubscriptionKey Request::subscribe(SubscriptionParams&& params, SubscriptionCall
 		throw schema_exception { std::move(errors) };
 	}
 
-	FragmentDefinitionVisitor fragmentVisitor(params.variables);
-
-	peg::for_each_child<peg::fragment_definition>(*params.query.root,
-		[&fragmentVisitor](const peg::ast_node& child) {
-			fragmentVisitor.visit(child);
-		});
-
-	auto fragments = fragmentVisitor.getFragments();
 	auto operationDefinition = findOperationDefinition(params.query, params.operationName);
+	auto fragments = buildFragments(*params.query.plan, params.variables);
 
 	if (!operationDefinition.second)
 	{
@@ -2159,6 +3310,8 @@ std::future<SubscriptionKey> Request::subscribe(
 					emptyFragmentDirectives,
 					{},
 					launch,
+					{},
+					registration->query.plan.get(),
 				};
 
 				try
@@ -2233,6 +3386,8 @@ std::future<void> Request::unsubscribe(std::launch launch, SubscriptionKey key)
 				emptyFragmentDirectives,
 				{},
 				launch,
+				{},
+				registration->query.plan.get(),
 			};
 
 			operation
@@ -2415,13 +3570,15 @@ void Request::deliver(std::launch launch, const SubscriptionName& name,
 			emptyFragmentDirectives,
 			std::nullopt,
 			launch,
+			{},
+			registration->query.plan.get(),
 		};
 
 		try
 		{
 			result = std::async(
 				launch,
-				[](std::future<ResolverResult>&& operationFuture) {
+				[](FieldResult<ResolverResult>&& operationFuture) {
 					auto result = operationFuture.get();
 					response::Value document { response::Type::Map };
 
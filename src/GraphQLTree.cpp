@@ -5,26 +5,170 @@
 #include "graphqlservice/GraphQLGrammar.h"
 #include "graphqlservice/GraphQLParse.h"
 
-#include <tao/pegtl/contrib/unescape.hpp>
-
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <new>
 #include <numeric>
+#include <string>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+
+// SSE2 is always available on x64, and AVX2 is detected at runtime.
+// clang-format off
+#if defined(__x86_64__) || defined(_M_X64)
+	#define GRAPHQL_SCAN_SIMD
+	#ifdef _MSC_VER
+		#include <intrin.h>
+		#define GRAPHQL_SCAN_AVX2_TARGET
+	#else // !_MSC_VER
+		#include <immintrin.h>
+		#define GRAPHQL_SCAN_AVX2_TARGET __attribute__((target("avx2")))
+	#endif // !_MSC_VER
+#endif // __x86_64__ || _M_X64
+// clang-format on
 
 using namespace std::literals;
 
 namespace graphql {
 namespace peg {
 
+namespace {
+
+thread_local ast_arena* t_currentArena = nullptr;
+
+// Each ast_node is prefixed with the arena it was allocated in, so operator delete knows whether
+// it needs to free the memory.
+struct alignas(std::max_align_t) ast_node_header
+{
+	ast_arena* arena;
+};
+
+} // namespace
+
+ast_arena::ast_arena() noexcept = default;
+
+ast_arena::~ast_arena() = default;
+
+ast_arena::scope::scope(ast_arena& arena) noexcept
+	: _previous { t_currentArena }
+{
+	t_currentArena = &arena;
+}
+
+ast_arena::scope::~scope()
+{
+	t_currentArena = _previous;
+}
+
+ast_arena* ast_arena::current() noexcept
+{
+	return t_currentArena;
+}
+
+void* ast_arena::allocate(size_t size, size_t alignment)
+{
+	const auto padding = static_cast<size_t>(
+		(alignment - (reinterpret_cast<uintptr_t>(_next) % alignment)) % alignment);
+
+	if (!_next || _remaining < size + padding)
+	{
+		// Grow the blocks geometrically up to a limit, but always make room for a large allocation.
+		const auto blockSize = std::max(_nextBlockSize, size + alignment);
+
+		// Don't use std::make_unique, there's no need to zero-initialize the block.
+		_blocks.push_back(std::unique_ptr<char[]>(new char[blockSize]));
+		_next = _blocks.back().get();
+		_remaining = blockSize;
+		_nextBlockSize = std::min(_nextBlockSize * 2, s_maxBlockSize);
+
+		return allocate(size, alignment);
+	}
+
+	void* result = _next + padding;
+
+	_next += size + padding;
+	_remaining -= size + padding;
+
+	return result;
+}
+
+char* ast_arena::allocate_string(size_t size)
+{
+	std::lock_guard lock { _stringMutex };
+
+	return static_cast<char*>(allocate(size, alignof(char)));
+}
+
+void* ast_node::operator new(size_t size)
+{
+	const auto arena = t_currentArena;
+	void* memory = (arena ? arena->allocate(sizeof(ast_node_header) + size, alignof(ast_node_header))
+						  : ::operator new(sizeof(ast_node_header) + size));
+	auto header = new (memory) ast_node_header { arena };
+
+	return header + 1;
+}
+
+void ast_node::operator delete(void* ptr) noexcept
+{
+	if (!ptr)
+	{
+		return;
+	}
+
+	auto header = static_cast<ast_node_header*>(ptr) - 1;
+
+	// Memory in the arena is only released when the whole arena is destroyed.
+	if (!header->arena)
+	{
+		::operator delete(header);
+	}
+}
+
+void ast_line_index::reset(const char* begin, const char* end, std::string_view source)
+{
+	_begin = begin;
+	_end = end;
+	_source = source;
+}
+
+position ast_line_index::find(const char* data) const
+{
+	std::call_once(_lineStartsOnce, [this]() {
+		_lineStarts.push_back(0);
+
+		for (auto itr = std::find(_begin, _end, '\n'); itr != _end;
+			 itr = std::find(itr + 1, _end, '\n'))
+		{
+			_lineStarts.push_back(static_cast<size_t>(itr + 1 - _begin));
+		}
+	});
+
+	const auto offset = static_cast<size_t>(data - _begin);
+	const auto itr = std::upper_bound(_lineStarts.cbegin(), _lineStarts.cend(), offset) - 1;
+	const auto line = static_cast<size_t>(itr - _lineStarts.cbegin()) + 1;
+	const auto column = offset - *itr + 1;
+
+	return { offset, line, column, _source };
+}
+
 bool ast_node::is_root() const noexcept
 {
-	return _type.empty();
+	return _rule == ast_rule::none;
 }
 
 position ast_node::begin() const noexcept
 {
-	return { _begin, _source };
+	if (!_lines)
+	{
+		return { 0, 1, 1, std::string {} };
+	}
+
+	return _lines->find(_content.data());
 }
 
 std::string_view ast_node::string_view() const noexcept
@@ -39,61 +183,192 @@ std::string ast_node::string() const noexcept
 
 void ast_node::unescaped_view(std::string_view unescaped) noexcept
 {
-	_unescaped = std::make_unique<unescaped_t>(unescaped);
+	_unescaped = std::make_optional(unescaped);
 }
 
 std::string_view ast_node::unescaped_view() const
 {
-	if (!_unescaped)
+	if (_unescaped)
 	{
-		if (children.size() > 1)
+		return *_unescaped;
+	}
+
+	std::call_once(_unescapedOnce, [this]() {
+		if (children.size() == 1)
+		{
+			// A single child without escape sequences is just a view of the source.
+			_unescapedCache = children.front()->unescaped_view();
+		}
+		else if (const auto capacity = unescaped_capacity(); capacity == 0)
+		{
+			_unescapedCache = {};
+		}
+		else if (const auto arena = children.get_allocator().arena())
 		{
-			std::string joined;
+			const auto data = arena->allocate_string(capacity);
+			const auto end = write_unescaped(data);
 
-			joined.reserve(std::accumulate(children.cbegin(),
-				children.cend(),
-				size_t(0),
-				[](size_t total, const std::unique_ptr<ast_node>& child) {
-					return total + child->string_view().size();
-				}));
+			_unescapedCache = { data, static_cast<size_t>(end - data) };
+		}
+		else
+		{
+			auto copy = std::make_unique<std::string>(capacity, '\0');
 
-			for (const auto& child : children)
-			{
-				joined.append(child->string_view());
-			}
+			copy->resize(static_cast<size_t>(write_unescaped(copy->data()) - copy->data()));
+			_unescapedCopy = std::move(copy);
+			_unescapedCache = *_unescapedCopy;
+		}
+	});
+
+	return _unescapedCache;
+}
 
-			const_cast<ast_node*>(this)->_unescaped =
-				std::make_unique<unescaped_t>(std::move(joined));
+std::string ast_node::unescaped() const
+{
+	if (_unescaped)
+	{
+		return std::string { *_unescaped };
+	}
+
+	std::string result(unescaped_capacity(), '\0');
+
+	result.resize(static_cast<size_t>(write_unescaped(result.data()) - result.data()));
+
+	return result;
+}
+
+// This is exact unless there are escaped_unicode sequences, which never take more bytes in UTF-8
+// than they do in the source.
+size_t ast_node::unescaped_capacity() const noexcept
+{
+	if (_unescaped)
+	{
+		return _unescaped->size();
+	}
+	else if (children.empty())
+	{
+		return is_type<escaped_unicode>() ? string_view().size() : 0;
+	}
+
+	return std::accumulate(children.cbegin(),
+		children.cend(),
+		size_t(0),
+		[](size_t total, const std::unique_ptr<ast_node>& child) noexcept {
+			return total + child->unescaped_capacity();
+		});
+}
+
+namespace {
+
+unsigned unhex(const char* digits) noexcept
+{
+	unsigned result = 0;
+
+	for (size_t i = 0; i < 4; ++i)
+	{
+		const char ch = digits[i];
+
+		result <<= 4;
+
+		if (ch >= '0' && ch <= '9')
+		{
+			result += static_cast<unsigned>(ch - '0');
 		}
-		else if (!children.empty())
+		else if (ch >= 'a' && ch <= 'f')
 		{
-			const_cast<ast_node*>(this)->_unescaped =
-				std::make_unique<unescaped_t>(children.front()->string_view());
+			result += static_cast<unsigned>(ch - 'a' + 10);
 		}
-		else if (has_content() && is_type<escaped_unicode>())
+		else
 		{
-			const auto content = string_view();
-			memory_input<> in(content.data(), content.size(), "escaped unicode");
-			std::string utf8;
+			result += static_cast<unsigned>(ch - 'A' + 10);
+		}
+	}
+
+	return result;
+}
+
+char* writeUtf8(unsigned codepoint, char* output) noexcept
+{
+	if (codepoint < 0x80)
+	{
+		*output++ = static_cast<char>(codepoint);
+	}
+	else if (codepoint < 0x800)
+	{
+		*output++ = static_cast<char>(0xC0 | (codepoint >> 6));
+		*output++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+	}
+	else if (codepoint < 0x10000)
+	{
+		*output++ = static_cast<char>(0xE0 | (codepoint >> 12));
+		*output++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+		*output++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+	}
+	else
+	{
+		*output++ = static_cast<char>(0xF0 | (codepoint >> 18));
+		*output++ = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+		*output++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+		*output++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+	}
 
-			utf8.reserve((content.size() + 1) / 2);
-			unescape::unescape_j::apply(in, utf8);
+	return output;
+}
 
-			const_cast<ast_node*>(this)->_unescaped =
-				std::make_unique<unescaped_t>(std::move(utf8));
+// The content of an escaped_unicode node is a list of 4 hex digit code units, e.g. u0041 or
+// uD83D\uDE00, and UTF-16 surrogate pairs are combined into a single code point.
+char* writeEscapedUnicode(std::string_view content, char* output) noexcept
+{
+	constexpr size_t codeUnitSize = 6;
+
+	for (size_t offset = 1; offset + 4 <= content.size(); offset += codeUnitSize)
+	{
+		auto codepoint = unhex(content.data() + offset);
+
+		if (codepoint >= 0xD800 && codepoint <= 0xDBFF
+			&& offset + codeUnitSize + 4 <= content.size())
+		{
+			const auto low = unhex(content.data() + offset + codeUnitSize);
+
+			if (low >= 0xDC00 && low <= 0xDFFF)
+			{
+				codepoint = (((codepoint & 0x3FF) << 10) | (low & 0x3FF)) + 0x10000;
+				offset += codeUnitSize;
+			}
 		}
-		else
+
+		output = writeUtf8(codepoint, output);
+	}
+
+	return output;
+}
+
+} // namespace
+
+char* ast_node::write_unescaped(char* output) const noexcept
+{
+	if (_unescaped)
+	{
+		if (!_unescaped->empty())
 		{
-			const_cast<ast_node*>(this)->_unescaped =
-				std::make_unique<unescaped_t>(std::string_view {});
+			std::memcpy(output, _unescaped->data(), _unescaped->size());
 		}
+
+		return output + _unescaped->size();
+	}
+	else if (children.empty())
+	{
+		return (has_content() && is_type<escaped_unicode>())
+			? writeEscapedUnicode(string_view(), output)
+			: output;
 	}
 
-	return std::visit(
-		[](const auto& value) noexcept {
-			return std::string_view { value };
-		},
-		*_unescaped);
+	for (const auto& child : children)
+	{
+		output = child->write_unescaped(output);
+	}
+
+	return output;
 }
 
 bool ast_node::has_content() const noexcept
@@ -101,6 +376,267 @@ bool ast_node::has_content() const noexcept
 	return !string_view().empty();
 }
 
+namespace {
+
+template <scan_class Characters>
+constexpr bool isScanCharacter(unsigned char ch) noexcept
+{
+	if constexpr (Characters == scan_class::ignored)
+	{
+		return ch == ' ' || ch == ',' || (ch >= '\t' && ch <= '\r');
+	}
+	else
+	{
+		const bool isLineTerminator = ch == '\n' || ch == '\r';
+
+		return (ch >= 0x20 && ch < 0x80 && ch != '"' && ch != '\\') || ch == '\t'
+			|| (Characters == scan_class::block_string_character && isLineTerminator);
+	}
+}
+
+template <scan_class Characters>
+size_t scanScalar(const char* begin, const char* end) noexcept
+{
+	const char* itr = begin;
+
+	while (itr != end && isScanCharacter<Characters>(static_cast<unsigned char>(*itr)))
+	{
+		++itr;
+	}
+
+	return static_cast<size_t>(itr - begin);
+}
+
+#ifdef GRAPHQL_SCAN_SIMD
+
+unsigned countTrailingZeros(unsigned mask) noexcept
+{
+#ifdef _MSC_VER
+	unsigned long index;
+
+	_BitScanForward(&index, mask);
+
+	return static_cast<unsigned>(index);
+#else  // !_MSC_VER
+	return static_cast<unsigned>(__builtin_ctz(mask));
+#endif // !_MSC_VER
+}
+
+template <scan_class Characters>
+__m128i classifySSE2(__m128i bytes) noexcept
+{
+	if constexpr (Characters == scan_class::ignored)
+	{
+		// '\t', '\n', '\v', '\f', and '\r' are contiguous, so check them with an unsigned range.
+		const auto offset = _mm_sub_epi8(bytes, _mm_set1_epi8('\t'));
+		const auto control = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(4)), offset);
+
+		return _mm_or_si128(control,
+			_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(' ')),
+				_mm_cmpeq_epi8(bytes, _mm_set1_epi8(','))));
+	}
+	else
+	{
+		// Bytes from 0x20 through 0x7F are the only ones greater than 0x1F as signed chars.
+		auto accepted = _mm_andnot_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('"')),
+				_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\\'))),
+			_mm_cmpgt_epi8(bytes, _mm_set1_epi8(0x1F)));
+
+		accepted = _mm_or_si128(accepted, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t')));
+
+		if constexpr (Characters == scan_class::block_string_character)
+		{
+			accepted = _mm_or_si128(accepted,
+				_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n')),
+					_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r'))));
+		}
+
+		return accepted;
+	}
+}
+
+template <scan_class Characters>
+size_t scanSSE2(const char* begin, const char* end) noexcept
+{
+	const char* itr = begin;
+
+	for (; end - itr >= 16; itr += 16)
+	{
+		const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(itr));
+		const auto rejected =
+			static_cast<unsigned>(_mm_movemask_epi8(classifySSE2<Characters>(bytes))) ^ 0xFFFFu;
+
+		if (rejected != 0)
+		{
+			return static_cast<size_t>(itr - begin) + countTrailingZeros(rejected);
+		}
+	}
+
+	return static_cast<size_t>(itr - begin) + scanScalar<Characters>(itr, end);
+}
+
+template <scan_class Characters>
+GRAPHQL_SCAN_AVX2_TARGET __m256i classifyAVX2(__m256i bytes) noexcept
+{
+	if constexpr (Characters == scan_class::ignored)
+	{
+		const auto offset = _mm256_sub_epi8(bytes, _mm256_set1_epi8('\t'));
+		const auto control =
+			_mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(4)), offset);
+
+		return _mm256_or_si256(control,
+			_mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(' ')),
+				_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(','))));
+	}
+	else
+	{
+		auto accepted = _mm256_andnot_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('"')),
+				_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\\'))),
+			_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8(0x1F)));
+
+		accepted = _mm256_or_si256(accepted, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\t')));
+
+		if constexpr (Characters == scan_class::block_string_character)
+		{
+			accepted = _mm256_or_si256(accepted,
+				_mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n')),
+					_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\r'))));
+		}
+
+		return accepted;
+	}
+}
+
+template <scan_class Characters>
+GRAPHQL_SCAN_AVX2_TARGET size_t scanAVX2(const char* begin, const char* end) noexcept
+{
+	const char* itr = begin;
+
+	for (; end - itr >= 32; itr += 32)
+	{
+		const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(itr));
+		const auto rejected =
+			~static_cast<unsigned>(_mm256_movemask_epi8(classifyAVX2<Characters>(bytes)));
+
+		if (rejected != 0)
+		{
+			return static_cast<size_t>(itr - begin) + countTrailingZeros(rejected);
+		}
+	}
+
+	// Finish the last partial block with SSE2 and the scalar loop.
+	return static_cast<size_t>(itr - begin) + scanSSE2<Characters>(itr, end);
+}
+
+bool hasAVX2() noexcept
+{
+#ifdef _MSC_VER
+	int info[4];
+
+	__cpuid(info, 0);
+
+	if (info[0] < 7)
+	{
+		return false;
+	}
+
+	// The OS must also save the YMM registers on a context switch.
+	__cpuid(info, 1);
+
+	constexpr int osxsave = 1 << 27;
+
+	if ((info[2] & osxsave) == 0 || (_xgetbv(0) & 0x6) != 0x6)
+	{
+		return false;
+	}
+
+	__cpuidex(info, 7, 0);
+
+	constexpr int avx2 = 1 << 5;
+
+	return (info[1] & avx2) != 0;
+#else  // !_MSC_VER
+	return __builtin_cpu_supports("avx2");
+#endif // !_MSC_VER
+}
+
+#endif // GRAPHQL_SCAN_SIMD
+
+struct scan_functions
+{
+	using scan_function = size_t (*)(const char*, const char*) noexcept;
+
+	template <template <scan_class> class Select>
+	static scan_functions make() noexcept
+	{
+		return { Select<scan_class::ignored>::function,
+			Select<scan_class::string_character>::function,
+			Select<scan_class::block_string_character>::function };
+	}
+
+	scan_function ignored;
+	scan_function string_character;
+	scan_function block_string_character;
+};
+
+template <scan_class Characters>
+struct select_scalar
+{
+	static constexpr scan_functions::scan_function function = scanScalar<Characters>;
+};
+
+#ifdef GRAPHQL_SCAN_SIMD
+
+template <scan_class Characters>
+struct select_sse2
+{
+	static constexpr scan_functions::scan_function function = scanSSE2<Characters>;
+};
+
+template <scan_class Characters>
+struct select_avx2
+{
+	static constexpr scan_functions::scan_function function = scanAVX2<Characters>;
+};
+
+#endif // GRAPHQL_SCAN_SIMD
+
+// Pick the widest implementation which the CPU supports once, the first time it's needed.
+const scan_functions& getScanFunctions() noexcept
+{
+	static const scan_functions functions =
+#ifdef GRAPHQL_SCAN_SIMD
+		hasAVX2() ? scan_functions::make<select_avx2>() : scan_functions::make<select_sse2>();
+#else  // !GRAPHQL_SCAN_SIMD
+		scan_functions::make<select_scalar>();
+#endif // !GRAPHQL_SCAN_SIMD
+
+	return functions;
+}
+
+} // namespace
+
+size_t scan_run(scan_class characters, const char* begin, const char* end) noexcept
+{
+	const auto& functions = getScanFunctions();
+
+	switch (characters)
+	{
+		case scan_class::ignored:
+			return functions.ignored(begin, end);
+
+		case scan_class::string_character:
+			return functions.string_character(begin, end);
+
+		case scan_class::block_string_character:
+			return functions.block_string_character(begin, end);
+	}
+
+	return 0;
+}
+
 using namespace tao::graphqlpeg;
 
 template <typename Rule>
@@ -156,7 +692,8 @@ struct ast_selector<escaped_unicode> : std::true_type
 template <>
 struct ast_selector<escaped_char> : std::true_type
 {
-	static void transform(std::unique_ptr<ast_node>& n)
+	template <typename... States>
+	static void transform(std::unique_ptr<ast_node>& n, States&&...)
 	{
 		if (n->has_content())
 		{
@@ -208,7 +745,8 @@ struct ast_selector<escaped_char> : std::true_type
 template <>
 struct ast_selector<string_quote_character> : std::true_type
 {
-	static void transform(std::unique_ptr<ast_node>& n)
+	template <typename... States>
+	static void transform(std::unique_ptr<ast_node>& n, States&&...)
 	{
 		n->unescaped_view(n->string_view());
 	}
@@ -217,7 +755,8 @@ struct ast_selector<string_quote_character> : std::true_type
 template <>
 struct ast_selector<block_escape_sequence> : std::true_type
 {
-	static void transform(std::unique_ptr<ast_node>& n)
+	template <typename... States>
+	static void transform(std::unique_ptr<ast_node>& n, States&&...)
 	{
 		n->unescaped_view(R"bq(""")bq"sv);
 	}
@@ -226,7 +765,8 @@ struct ast_selector<block_escape_sequence> : std::true_type
 template <>
 struct ast_selector<block_quote_character> : std::true_type
 {
-	static void transform(std::unique_ptr<ast_node>& n)
+	template <typename... States>
+	static void transform(std::unique_ptr<ast_node>& n, States&&...)
 	{
 		n->unescaped_view(n->string_view());
 	}
@@ -547,11 +1087,68 @@ struct executable_selector<type_condition> : std::true_type
 {
 };
 
+// Rules which nest inside of themselves, and count towards the parse_limits::maxDepth. These are
+// the contents after the opening bracket, so just looking ahead for a nested rule doesn't count.
+template <typename Rule>
+inline constexpr bool is_nesting_rule = std::is_same_v<Rule, selection_set_content>
+	|| std::is_same_v<Rule, list_value_content> || std::is_same_v<Rule, object_value_content>
+	|| std::is_same_v<Rule, list_type_content>;
+
+// Running totals for the parse_limits, which ast_control updates as it matches each rule.
+struct parse_guard
+{
+	const parse_limits& limits;
+	size_t depth = 0;
+	size_t nodes = 0;
+};
+
 template <typename Rule>
 struct ast_control : normal<Rule>
 {
 	static const std::string error_message;
 
+	template <typename Input>
+	static void start(const Input& in, const ast_line_index&, parse_guard& guard)
+	{
+		if constexpr (is_nesting_rule<Rule>)
+		{
+			if (++guard.depth > guard.limits.maxDepth)
+			{
+				throw parse_error("Exceeded the limit of "s
+						+ std::to_string(guard.limits.maxDepth) + " nested levels",
+					in);
+			}
+		}
+	}
+
+	template <typename Input>
+	static void success(const Input& in, const ast_line_index&, parse_guard& guard)
+	{
+		if constexpr (is_nesting_rule<Rule>)
+		{
+			--guard.depth;
+		}
+
+		if constexpr (ast_rule_id<Rule> != ast_rule::none)
+		{
+			if (++guard.nodes > guard.limits.maxNodes)
+			{
+				throw parse_error("Exceeded the limit of "s
+						+ std::to_string(guard.limits.maxNodes) + " nodes",
+					in);
+			}
+		}
+	}
+
+	template <typename Input>
+	static void failure(const Input&, const ast_line_index&, parse_guard& guard) noexcept
+	{
+		if constexpr (is_nesting_rule<Rule>)
+		{
+			--guard.depth;
+		}
+	}
+
 	template <typename Input, typename... State>
 	[[noreturn]] static void raise(const Input& in, State&&...)
 	{
@@ -731,120 +1328,138 @@ template <>
 const std::string ast_control<schema_document_content>::error_message =
 	"Expected schema type http://spec.graphql.org/June2018/#Document";
 
-ast parseSchemaString(std::string_view input)
+// Allocate a new ast_input with its own ast_arena.
+std::shared_ptr<ast_input> makeInput(decltype(ast_input::data)&& data)
 {
-	ast result { std::make_shared<ast_input>(
-					 ast_input { std::vector<char> { input.cbegin(), input.cend() } }),
-		{} };
-	const auto& data = std::get<std::vector<char>>(result.input->data);
+	auto input = std::make_shared<ast_input>();
 
-	try
-	{
-		// Try a smaller grammar with only schema type definitions first.
-		result.root =
-			parse_tree::parse<schema_document, ast_node, schema_selector, nothing, ast_control>(
-				memory_input<>(data.data(), data.size(), "GraphQL"));
-	}
-	catch (const peg::parse_error&)
+	input->data = std::move(data);
+
+	return input;
+}
+
+// Check the size of the document before parsing it, or before copying it into the ast_input.
+void checkDocumentSize(size_t size, const parse_limits& limits, std::string_view source)
+{
+	if (size > limits.maxBytes)
 	{
-		// Try again with the full document grammar so validation can handle the unexepected
-		// executable definitions if this is a mixed document.
-		result.root =
-			parse_tree::parse<mixed_document, ast_node, schema_selector, nothing, ast_control>(
-				memory_input<>(data.data(), data.size(), "GraphQL"));
+		throw parse_error("Exceeded the limit of "s + std::to_string(limits.maxBytes) + " bytes",
+			position { 0, 1, 1, std::string { source } });
 	}
-
-	return result;
 }
 
-ast parseSchemaFile(std::string_view filename)
+// Parse the document with all of its nodes allocated in the ast_arena of the ast_input. The root
+// shares ownership of the ast_input, so the whole tree is released at once along with the input,
+// instead of destroying each of the nodes.
+//
+// The mixed_document grammar accepts executable and type system definitions in a single pass, so
+// a document with unexpected definitions doesn't need to be parsed again with a different grammar.
+// The Selector still determines which nodes are kept for the expected kind of document, and the
+// kinds of definitions in the document are recorded so validation can reject the unexpected ones.
+//
+// The ast_control enforces the parse_limits while it matches each rule, so a document which
+// exceeds them stops parsing right away.
+template <template <typename...> class Selector, typename Input>
+void parseTree(ast& result, Input&& in, const parse_limits& limits)
 {
-	ast result;
+	checkDocumentSize(static_cast<size_t>(in.end() - in.begin()), limits, in.source());
 
-	try
-	{
-		result.input =
-			std::make_shared<ast_input>(ast_input { std::make_unique<file_input<>>(filename) });
+	ast_arena::scope arenaScope { result.input->arena };
+	parse_guard guard { limits };
 
-		auto& in = *std::get<std::unique_ptr<file_input<>>>(result.input->data);
+	result.input->lines.reset(in.begin(), in.end(), in.source());
 
-		// Try a smaller grammar with only schema type definitions first.
-		result.root =
-			parse_tree::parse<schema_document, ast_node, schema_selector, nothing, ast_control>(
-				std::move(in));
-	}
-	catch (const peg::parse_error&)
-	{
-		result.input =
-			std::make_shared<ast_input>(ast_input { std::make_unique<file_input<>>(filename) });
+	auto root = parse_tree::parse<mixed_document, ast_node, Selector, nothing, ast_control>(
+		std::forward<Input>(in),
+		std::as_const(result.input->lines),
+		guard);
 
-		auto& in = *std::get<std::unique_ptr<file_input<>>>(result.input->data);
+	result.root = { result.input, root.release() };
 
-		// Try again with the full document grammar so validation can handle the unexepected
-		// executable definitions if this is a mixed document.
-		result.root =
-			parse_tree::parse<mixed_document, ast_node, schema_selector, nothing, ast_control>(
-				std::move(in));
+	for (const auto& child : result.root->children)
+	{
+		if (child->is_type<operation_definition>() || child->is_type<fragment_definition>())
+		{
+			result.hasExecutableDefinitions = true;
+		}
+		else
+		{
+			result.hasTypeSystemDefinitions = true;
+		}
 	}
+}
+
+// Parse a document which is held in memory by the ast_input, either in a buffer which it owns or
+// in a std::string_view which it borrows from the caller.
+template <template <typename...> class Selector, typename Data>
+ast parseBuffer(Data&& data, const parse_limits& limits)
+{
+	ast result { makeInput(std::forward<Data>(data)), {} };
+	const auto& buffer = std::get<std::decay_t<Data>>(result.input->data);
+
+	parseTree<Selector>(result,
+		memory_input<tracking_mode::lazy>(buffer.data(), buffer.size(), "GraphQL"),
+		limits);
 
 	return result;
 }
 
-ast parseString(std::string_view input)
+ast parseSchemaString(std::string_view input, const parse_limits& limits)
 {
-	ast result { std::make_shared<ast_input>(
-					 ast_input { std::vector<char> { input.cbegin(), input.cend() } }),
-		{} };
-	const auto& data = std::get<std::vector<char>>(result.input->data);
+	checkDocumentSize(input.size(), limits, "GraphQL"sv);
 
-	try
-	{
-		// Try a smaller grammar with only executable definitions first.
-		result.root = parse_tree::
-			parse<executable_document, ast_node, executable_selector, nothing, ast_control>(
-				memory_input<>(data.data(), data.size(), "GraphQL"));
-	}
-	catch (const peg::parse_error&)
-	{
-		// Try again with the full document grammar so validation can handle the unexepected type
-		// definitions if this is a mixed document.
-		result.root =
-			parse_tree::parse<mixed_document, ast_node, executable_selector, nothing, ast_control>(
-				memory_input<>(data.data(), data.size(), "GraphQL"));
-	}
+	return parseBuffer<schema_selector>(std::vector<char> { input.cbegin(), input.cend() }, limits);
+}
+
+ast parseSchemaString(std::string&& input, const parse_limits& limits)
+{
+	return parseBuffer<schema_selector>(std::move(input), limits);
+}
+
+ast parseSchemaString(std::vector<char>&& input, const parse_limits& limits)
+{
+	return parseBuffer<schema_selector>(std::move(input), limits);
+}
+
+ast parseSchemaFile(std::string_view filename, const parse_limits& limits)
+{
+	ast result { makeInput(std::make_unique<file_input<tracking_mode::lazy>>(filename)), {} };
+	auto& in = *std::get<std::unique_ptr<file_input<tracking_mode::lazy>>>(result.input->data);
+
+	parseTree<schema_selector>(result, std::move(in), limits);
 
 	return result;
 }
 
-ast parseFile(std::string_view filename)
+ast parseString(std::string_view input, const parse_limits& limits)
 {
-	ast result;
+	checkDocumentSize(input.size(), limits, "GraphQL"sv);
 
-	try
-	{
-		result.input =
-			std::make_shared<ast_input>(ast_input { std::make_unique<file_input<>>(filename) });
+	return parseBuffer<executable_selector>(std::vector<char> { input.cbegin(), input.cend() },
+		limits);
+}
 
-		auto& in = *std::get<std::unique_ptr<file_input<>>>(result.input->data);
+ast parseString(std::string&& input, const parse_limits& limits)
+{
+	return parseBuffer<executable_selector>(std::move(input), limits);
+}
 
-		// Try a smaller grammar with only executable definitions first.
-		result.root = parse_tree::
-			parse<executable_document, ast_node, executable_selector, nothing, ast_control>(
-				std::move(in));
-	}
-	catch (const peg::parse_error&)
-	{
-		result.input =
-			std::make_shared<ast_input>(ast_input { std::make_unique<file_input<>>(filename) });
+ast parseString(std::vector<char>&& input, const parse_limits& limits)
+{
+	return parseBuffer<executable_selector>(std::move(input), limits);
+}
 
-		auto& in = *std::get<std::unique_ptr<file_input<>>>(result.input->data);
+ast parseBorrowedString(std::string_view input, const parse_limits& limits)
+{
+	return parseBuffer<executable_selector>(input, limits);
+}
 
-		// Try again with the full document grammar so validation can handle the unexepected type
-		// definitions if this is a mixed document.
-		result.root =
-			parse_tree::parse<mixed_document, ast_node, executable_selector, nothing, ast_control>(
-				std::move(in));
-	}
+ast parseFile(std::string_view filename, const parse_limits& limits)
+{
+	ast result { makeInput(std::make_unique<file_input<tracking_mode::lazy>>(filename)), {} };
+	auto& in = *std::get<std::unique_ptr<file_input<tracking_mode::lazy>>>(result.input->data);
+
+	parseTree<executable_selector>(result, std::move(in), limits);
 
 	return result;
 }
@@ -853,31 +1468,7 @@ ast parseFile(std::string_view filename)
 
 peg::ast operator"" _graphql(const char* text, size_t size)
 {
-	peg::ast result { std::make_shared<peg::ast_input>(
-						  peg::ast_input { { std::string_view { text, size } } }),
-		{} };
-
-	try
-	{
-		// Try a smaller grammar with only executable definitions first.
-		result.root = peg::parse_tree::parse<peg::executable_document,
-			peg::ast_node,
-			peg::executable_selector,
-			peg::nothing,
-			peg::ast_control>(peg::memory_input<>(text, size, "GraphQL"));
-	}
-	catch (const peg::parse_error&)
-	{
-		// Try again with the full document grammar so validation can handle the unexepected type
-		// definitions if this is a mixed document.
-		result.root = peg::parse_tree::parse<peg::mixed_document,
-			peg::ast_node,
-			peg::executable_selector,
-			peg::nothing,
-			peg::ast_control>(peg::memory_input<>(text, size, "GraphQL"));
-	}
-
-	return result;
+	return peg::parseBorrowedString(std::string_view { text, size });
 }
 
 } /* namespace graphql */
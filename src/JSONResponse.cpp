@@ -10,13 +10,144 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <limits>
 #include <stdexcept>
 #include <vector>
 
 namespace graphql::response {
 
-void writeResponse(rapidjson::Writer<rapidjson::StringBuffer>& writer, Value&& response)
+// A rapidjson output stream which buffers up to one chunk of output at a time, and passes each
+// chunk to the JSONSink when it's full.
+class ChunkedStream
+{
+public:
+	using Ch = char;
+
+	explicit ChunkedStream(JSONSink& sink, size_t chunkSize)
+		: _sink { sink }
+		, _chunkSize { std::max(chunkSize, size_t { 1 }) }
+	{
+		_buffer.reserve(_chunkSize);
+	}
+
+	void Put(Ch c)
+	{
+		_buffer.push_back(c);
+
+		if (_buffer.size() == _chunkSize)
+		{
+			Flush();
+		}
+	}
+
+	void Write(std::string_view text)
+	{
+		while (!text.empty())
+		{
+			const auto count = std::min(text.size(), _chunkSize - _buffer.size());
+
+			_buffer.append(text.data(), count);
+			text.remove_prefix(count);
+
+			if (_buffer.size() == _chunkSize)
+			{
+				Flush();
+			}
+		}
+	}
+
+	void Flush()
+	{
+		if (!_buffer.empty())
+		{
+			_sink.write(_buffer);
+			_buffer.clear();
+		}
+	}
+
+private:
+	JSONSink& _sink;
+	const size_t _chunkSize;
+	std::string _buffer;
+};
+
+void writeRaw(rapidjson::StringBuffer& stream, std::string_view text)
+{
+	std::memcpy(stream.Push(text.size()), text.data(), text.size());
+}
+
+void writeRaw(ChunkedStream& stream, std::string_view text)
+{
+	stream.Write(text);
+}
+
+// Response keys are almost always field names or aliases, which are GraphQL Names and never need
+// to be escaped: http://spec.graphql.org/June2018/#Name
+bool isName(std::string_view key) noexcept
+{
+	static const auto s_nameCharacters = []() noexcept {
+		std::array<bool, 256> nameCharacters {};
+
+		for (unsigned char c = '0'; c <= '9'; ++c)
+		{
+			nameCharacters[c] = true;
+		}
+
+		for (unsigned char c = 'A'; c <= 'Z'; ++c)
+		{
+			nameCharacters[c] = true;
+			nameCharacters[c - 'A' + 'a'] = true;
+		}
+
+		nameCharacters['_'] = true;
+
+		return nameCharacters;
+	}();
+
+	return std::all_of(key.cbegin(), key.cend(), [](char c) noexcept {
+		return s_nameCharacters[static_cast<unsigned char>(c)];
+	});
+}
+
+// Extend the rapidjson::Writer so keys which are already known to be safe are copied into the
+// output without escaping them, and so strings are written with their length instead of calling
+// strlen.
+template <typename OutputStream>
+class ResponseWriter : public rapidjson::Writer<OutputStream>
+{
+public:
+	using Base = rapidjson::Writer<OutputStream>;
+
+	explicit ResponseWriter(OutputStream& stream)
+		: Base(stream)
+	{
+	}
+
+	void Key(std::string_view key)
+	{
+		if (!isName(key))
+		{
+			Base::Key(key.data(), static_cast<rapidjson::SizeType>(key.size()));
+			return;
+		}
+
+		Base::Prefix(rapidjson::kStringType);
+		Base::os_->Put('"');
+		writeRaw(*Base::os_, key);
+		Base::os_->Put('"');
+	}
+
+	void String(std::string_view value)
+	{
+		Base::String(value.data(), static_cast<rapidjson::SizeType>(value.size()));
+	}
+};
+
+template <typename OutputStream>
+void writeResponse(ResponseWriter<OutputStream>& writer, Value&& response)
 {
 	switch (response.type())
 	{
@@ -28,7 +159,7 @@ void writeResponse(rapidjson::Writer<rapidjson::StringBuffer>& writer, Value&& r
 
 			for (auto& entry : members)
 			{
-				writer.Key(entry.first.c_str());
+				writer.Key(entry.first);
 				writeResponse(writer, std::move(entry.second));
 			}
 
@@ -56,7 +187,7 @@ void writeResponse(rapidjson::Writer<rapidjson::StringBuffer>& writer, Value&& r
 		{
 			auto value = response.release<StringType>();
 
-			writer.String(value.c_str());
+			writer.String(value);
 			break;
 		}
 
@@ -101,12 +232,130 @@ void writeResponse(rapidjson::Writer<rapidjson::StringBuffer>& writer, Value&& r
 std::string toJSON(Value&& response)
 {
 	rapidjson::StringBuffer buffer;
-	rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+	ResponseWriter<rapidjson::StringBuffer> writer(buffer);
 
 	writeResponse(writer, std::move(response));
 	return buffer.GetString();
 }
 
+JSONSink::~JSONSink() = default;
+
+JSONCallbackSink::JSONCallbackSink(Callback&& callback)
+	: _callback { std::move(callback) }
+{
+}
+
+void JSONCallbackSink::write(std::string_view chunk)
+{
+	_callback(chunk);
+}
+
+JSONFileSink::JSONFileSink(std::FILE* file) noexcept
+	: _file { file }
+{
+}
+
+void JSONFileSink::write(std::string_view chunk)
+{
+	if (std::fwrite(chunk.data(), sizeof(char), chunk.size(), _file) != chunk.size())
+	{
+		throw std::runtime_error("Failed to write the JSON output");
+	}
+}
+
+struct JSONWriter::Impl
+{
+	explicit Impl(JSONSink& sink, size_t chunkSize)
+		: stream { sink, chunkSize }
+		, writer { stream }
+	{
+	}
+
+	ChunkedStream stream;
+	ResponseWriter<ChunkedStream> writer;
+};
+
+JSONWriter::JSONWriter(JSONSink& sink, size_t chunkSize)
+	: _impl { std::make_unique<Impl>(sink, chunkSize) }
+{
+}
+
+JSONWriter::~JSONWriter() = default;
+
+void JSONWriter::start_object()
+{
+	_impl->writer.StartObject();
+}
+
+void JSONWriter::add_member(std::string_view key)
+{
+	_impl->writer.Key(key);
+}
+
+void JSONWriter::end_object()
+{
+	_impl->writer.EndObject();
+	endValue();
+}
+
+void JSONWriter::start_list()
+{
+	_impl->writer.StartArray();
+}
+
+void JSONWriter::end_list()
+{
+	_impl->writer.EndArray();
+	endValue();
+}
+
+void JSONWriter::write_null()
+{
+	_impl->writer.Null();
+	endValue();
+}
+
+void JSONWriter::write_string(std::string_view value)
+{
+	_impl->writer.String(value);
+	endValue();
+}
+
+void JSONWriter::write_bool(BooleanType value)
+{
+	_impl->writer.Bool(value);
+	endValue();
+}
+
+void JSONWriter::write_int(IntType value)
+{
+	_impl->writer.Int(value);
+	endValue();
+}
+
+void JSONWriter::write_float(FloatType value)
+{
+	_impl->writer.Double(value);
+	endValue();
+}
+
+void JSONWriter::endValue()
+{
+	if (_impl->writer.IsComplete())
+	{
+		_impl->stream.Flush();
+	}
+}
+
+void writeJSON(Value&& response, JSONSink& sink, size_t chunkSize)
+{
+	ChunkedStream stream { sink, chunkSize };
+	ResponseWriter<ChunkedStream> writer(stream);
+
+	writeResponse(writer, std::move(response));
+	stream.Flush();
+}
+
 struct ResponseHandler : rapidjson::BaseReaderHandler<rapidjson::UTF8<>, ResponseHandler>
 {
 	ResponseHandler()
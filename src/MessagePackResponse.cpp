@@ -0,0 +1,668 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "graphqlservice/MessagePackResponse.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace graphql::response {
+
+// https://github.com/msgpack/msgpack/blob/master/spec.md#formats
+constexpr std::uint8_t msgpackPositiveFixIntMax = 0x7F;
+constexpr std::uint8_t msgpackFixMap = 0x80;
+constexpr std::uint8_t msgpackFixArray = 0x90;
+constexpr std::uint8_t msgpackFixStr = 0xA0;
+constexpr std::uint8_t msgpackNil = 0xC0;
+constexpr std::uint8_t msgpackFalse = 0xC2;
+constexpr std::uint8_t msgpackTrue = 0xC3;
+constexpr std::uint8_t msgpackBin8 = 0xC4;
+constexpr std::uint8_t msgpackBin16 = 0xC5;
+constexpr std::uint8_t msgpackBin32 = 0xC6;
+constexpr std::uint8_t msgpackExt8 = 0xC7;
+constexpr std::uint8_t msgpackExt16 = 0xC8;
+constexpr std::uint8_t msgpackExt32 = 0xC9;
+constexpr std::uint8_t msgpackFloat32 = 0xCA;
+constexpr std::uint8_t msgpackFloat64 = 0xCB;
+constexpr std::uint8_t msgpackUint8 = 0xCC;
+constexpr std::uint8_t msgpackUint16 = 0xCD;
+constexpr std::uint8_t msgpackUint32 = 0xCE;
+constexpr std::uint8_t msgpackUint64 = 0xCF;
+constexpr std::uint8_t msgpackInt8 = 0xD0;
+constexpr std::uint8_t msgpackInt16 = 0xD1;
+constexpr std::uint8_t msgpackInt32 = 0xD2;
+constexpr std::uint8_t msgpackInt64 = 0xD3;
+constexpr std::uint8_t msgpackFixExt1 = 0xD4;
+constexpr std::uint8_t msgpackFixExt2 = 0xD5;
+constexpr std::uint8_t msgpackFixExt4 = 0xD6;
+constexpr std::uint8_t msgpackFixExt8 = 0xD7;
+constexpr std::uint8_t msgpackFixExt16 = 0xD8;
+constexpr std::uint8_t msgpackStr8 = 0xD9;
+constexpr std::uint8_t msgpackStr16 = 0xDA;
+constexpr std::uint8_t msgpackStr32 = 0xDB;
+constexpr std::uint8_t msgpackArray16 = 0xDC;
+constexpr std::uint8_t msgpackArray32 = 0xDD;
+constexpr std::uint8_t msgpackMap16 = 0xDE;
+constexpr std::uint8_t msgpackMap32 = 0xDF;
+constexpr std::uint8_t msgpackNegativeFixIntMin = 0xE0;
+
+constexpr std::uint8_t msgpackFixMapMask = 0x0F;
+constexpr std::uint8_t msgpackFixArrayMask = 0x0F;
+constexpr std::uint8_t msgpackFixStrMask = 0x1F;
+
+class MessagePackEncoder
+{
+public:
+	explicit MessagePackEncoder(std::vector<std::uint8_t>& output)
+		: _output { output }
+	{
+	}
+
+	void encode(Value&& response)
+	{
+		switch (response.type())
+		{
+			case Type::Map:
+			{
+				auto members = response.release<MapType>();
+
+				writeLength(members.size(), msgpackFixMap, msgpackFixMapMask, 0, msgpackMap16,
+					msgpackMap32);
+
+				for (auto& entry : members)
+				{
+					writeString(entry.first);
+					encode(std::move(entry.second));
+				}
+
+				break;
+			}
+
+			case Type::List:
+			{
+				auto elements = response.release<ListType>();
+
+				writeLength(elements.size(), msgpackFixArray, msgpackFixArrayMask, 0,
+					msgpackArray16, msgpackArray32);
+
+				for (auto& entry : elements)
+				{
+					encode(std::move(entry));
+				}
+
+				break;
+			}
+
+			case Type::String:
+			{
+				writeString(response.get<StringType>());
+				break;
+			}
+
+			case Type::EnumValue:
+			{
+				const auto& value = response.get<StringType>();
+
+				writeExtHead(MessagePackExtEnumValue, value.size());
+				_output.insert(_output.end(), value.cbegin(), value.cend());
+				break;
+			}
+
+			case Type::Null:
+			{
+				_output.push_back(msgpackNil);
+				break;
+			}
+
+			case Type::Boolean:
+			{
+				_output.push_back(response.get<BooleanType>() ? msgpackTrue : msgpackFalse);
+				break;
+			}
+
+			case Type::Int:
+			{
+				writeInt(response.get<IntType>());
+				break;
+			}
+
+			case Type::Float:
+			{
+				const auto value = response.get<FloatType>();
+				std::uint64_t bits;
+
+				static_assert(sizeof(bits) == sizeof(value), "FloatType should be 64-bit");
+				std::memcpy(&bits, &value, sizeof(bits));
+				_output.push_back(msgpackFloat64);
+				writeBigEndian(bits, sizeof(bits));
+				break;
+			}
+
+			case Type::Scalar:
+			{
+				// The length of the extension comes before the data, so encode the wrapped value
+				// separately to find out how long it is.
+				std::vector<std::uint8_t> data;
+
+				MessagePackEncoder(data).encode(response.release<ScalarType>());
+				writeExtHead(MessagePackExtScalar, data.size());
+				_output.insert(_output.end(), data.cbegin(), data.cend());
+				break;
+			}
+
+			default:
+			{
+				_output.push_back(msgpackNil);
+				break;
+			}
+		}
+	}
+
+private:
+	void writeBigEndian(std::uint64_t value, size_t size)
+	{
+		for (size_t shift = size * 8; shift > 0; shift -= 8)
+		{
+			_output.push_back(static_cast<std::uint8_t>(value >> (shift - 8)));
+		}
+	}
+
+	// Always use the shortest format which can hold the value.
+	void writeInt(IntType value)
+	{
+		if (value >= 0)
+		{
+			if (value <= msgpackPositiveFixIntMax)
+			{
+				_output.push_back(static_cast<std::uint8_t>(value));
+			}
+			else if (value <= std::numeric_limits<std::uint8_t>::max())
+			{
+				_output.push_back(msgpackUint8);
+				writeBigEndian(static_cast<std::uint64_t>(value), sizeof(std::uint8_t));
+			}
+			else if (value <= std::numeric_limits<std::uint16_t>::max())
+			{
+				_output.push_back(msgpackUint16);
+				writeBigEndian(static_cast<std::uint64_t>(value), sizeof(std::uint16_t));
+			}
+			else
+			{
+				_output.push_back(msgpackUint32);
+				writeBigEndian(static_cast<std::uint64_t>(value), sizeof(std::uint32_t));
+			}
+		}
+		else
+		{
+			const auto bits = static_cast<std::uint32_t>(value);
+
+			if (value >= -32)
+			{
+				_output.push_back(static_cast<std::uint8_t>(bits));
+			}
+			else if (value >= std::numeric_limits<std::int8_t>::min())
+			{
+				_output.push_back(msgpackInt8);
+				writeBigEndian(bits, sizeof(std::int8_t));
+			}
+			else if (value >= std::numeric_limits<std::int16_t>::min())
+			{
+				_output.push_back(msgpackInt16);
+				writeBigEndian(bits, sizeof(std::int16_t));
+			}
+			else
+			{
+				_output.push_back(msgpackInt32);
+				writeBigEndian(bits, sizeof(std::int32_t));
+			}
+		}
+	}
+
+	void writeLength(size_t length, std::uint8_t fixFormat, std::uint8_t fixMask,
+		std::uint8_t format8, std::uint8_t format16, std::uint8_t format32)
+	{
+		if (length <= fixMask)
+		{
+			_output.push_back(static_cast<std::uint8_t>(fixFormat | length));
+		}
+		else if (format8 != 0 && length <= std::numeric_limits<std::uint8_t>::max())
+		{
+			_output.push_back(format8);
+			writeBigEndian(length, sizeof(std::uint8_t));
+		}
+		else if (length <= std::numeric_limits<std::uint16_t>::max())
+		{
+			_output.push_back(format16);
+			writeBigEndian(length, sizeof(std::uint16_t));
+		}
+		else if (length <= std::numeric_limits<std::uint32_t>::max())
+		{
+			_output.push_back(format32);
+			writeBigEndian(length, sizeof(std::uint32_t));
+		}
+		else
+		{
+			throw std::length_error("MessagePack is limited to 32-bit lengths");
+		}
+	}
+
+	void writeString(std::string_view value)
+	{
+		writeLength(value.size(), msgpackFixStr, msgpackFixStrMask, msgpackStr8, msgpackStr16,
+			msgpackStr32);
+		_output.insert(_output.end(), value.cbegin(), value.cend());
+	}
+
+	void writeExtHead(std::int8_t type, size_t length)
+	{
+		switch (length)
+		{
+			case 1:
+				_output.push_back(msgpackFixExt1);
+				break;
+
+			case 2:
+				_output.push_back(msgpackFixExt2);
+				break;
+
+			case 4:
+				_output.push_back(msgpackFixExt4);
+				break;
+
+			case 8:
+				_output.push_back(msgpackFixExt8);
+				break;
+
+			case 16:
+				_output.push_back(msgpackFixExt16);
+				break;
+
+			default:
+				if (length <= std::numeric_limits<std::uint8_t>::max())
+				{
+					_output.push_back(msgpackExt8);
+					writeBigEndian(length, sizeof(std::uint8_t));
+				}
+				else if (length <= std::numeric_limits<std::uint16_t>::max())
+				{
+					_output.push_back(msgpackExt16);
+					writeBigEndian(length, sizeof(std::uint16_t));
+				}
+				else if (length <= std::numeric_limits<std::uint32_t>::max())
+				{
+					_output.push_back(msgpackExt32);
+					writeBigEndian(length, sizeof(std::uint32_t));
+				}
+				else
+				{
+					throw std::length_error("MessagePack is limited to 32-bit lengths");
+				}
+
+				break;
+		}
+
+		_output.push_back(static_cast<std::uint8_t>(type));
+	}
+
+	std::vector<std::uint8_t>& _output;
+};
+
+std::vector<std::uint8_t> toMessagePack(Value&& response)
+{
+	std::vector<std::uint8_t> msgpack;
+
+	MessagePackEncoder(msgpack).encode(std::move(response));
+
+	return msgpack;
+}
+
+class MessagePackDecoder
+{
+public:
+	explicit MessagePackDecoder(const std::vector<std::uint8_t>& input)
+		: _input { input }
+	{
+	}
+
+	Value decode()
+	{
+		auto response = decodeObject();
+
+		if (_offset != _input.size())
+		{
+			throw std::runtime_error("Unexpected data after the MessagePack value");
+		}
+
+		return response;
+	}
+
+private:
+	std::uint8_t next()
+	{
+		if (_offset >= _input.size())
+		{
+			throw std::runtime_error("Unexpected end of the MessagePack value");
+		}
+
+		return _input[_offset++];
+	}
+
+	std::uint64_t readBigEndian(size_t size)
+	{
+		if (_input.size() - _offset < size)
+		{
+			throw std::runtime_error("Unexpected end of the MessagePack value");
+		}
+
+		std::uint64_t value = 0;
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			value = (value << 8) | _input[_offset++];
+		}
+
+		return value;
+	}
+
+	// Don't trust the length from the input to reserve space for the elements, each of them takes
+	// at least 1 byte.
+	size_t reserveCount(size_t count) const noexcept
+	{
+		return std::min(count, _input.size() - _offset);
+	}
+
+	std::string readString(size_t length)
+	{
+		if (length > _input.size() - _offset)
+		{
+			throw std::runtime_error("Unexpected end of the MessagePack value");
+		}
+
+		const auto begin = _input.cbegin() + static_cast<std::ptrdiff_t>(_offset);
+
+		_offset += length;
+
+		return std::string(begin, begin + static_cast<std::ptrdiff_t>(length));
+	}
+
+	std::string decodeKey()
+	{
+		const auto format = next();
+
+		if ((format & ~msgpackFixStrMask) == msgpackFixStr)
+		{
+			return readString(format & msgpackFixStrMask);
+		}
+
+		switch (format)
+		{
+			case msgpackStr8:
+				return readString(static_cast<size_t>(readBigEndian(sizeof(std::uint8_t))));
+
+			case msgpackStr16:
+				return readString(static_cast<size_t>(readBigEndian(sizeof(std::uint16_t))));
+
+			case msgpackStr32:
+				return readString(static_cast<size_t>(readBigEndian(sizeof(std::uint32_t))));
+
+			default:
+				throw std::runtime_error("MessagePack map keys must be strings");
+		}
+	}
+
+	static Value makeInt(std::int64_t value)
+	{
+		// http://spec.graphql.org/June2018/#sec-Int
+		if (value < std::numeric_limits<IntType>::min()
+			|| value > std::numeric_limits<IntType>::max())
+		{
+			throw std::overflow_error("GraphQL only supports 32-bit signed integers");
+		}
+
+		return Value(static_cast<IntType>(value));
+	}
+
+	static Value makeUnsigned(std::uint64_t value)
+	{
+		if (value > static_cast<std::uint64_t>(std::numeric_limits<IntType>::max()))
+		{
+			// http://spec.graphql.org/June2018/#sec-Int
+			throw std::overflow_error("GraphQL only supports 32-bit signed integers");
+		}
+
+		return Value(static_cast<IntType>(value));
+	}
+
+	static Value makeFloat(FloatType value)
+	{
+		Value response(Type::Float);
+
+		response.set<FloatType>(value);
+
+		return response;
+	}
+
+	Value decodeList(size_t count)
+	{
+		Value response(Type::List);
+
+		response.reserve(reserveCount(count));
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			response.emplace_back(decodeObject());
+		}
+
+		return response;
+	}
+
+	Value decodeMap(size_t count)
+	{
+		Value response(Type::Map);
+
+		response.reserve(reserveCount(count));
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			auto key = decodeKey();
+
+			response.emplace_back(std::move(key), decodeObject());
+		}
+
+		return response;
+	}
+
+	Value decodeExt(size_t length)
+	{
+		const auto type = static_cast<std::int8_t>(next());
+
+		if (length > _input.size() - _offset)
+		{
+			throw std::runtime_error("Unexpected end of the MessagePack value");
+		}
+
+		switch (type)
+		{
+			case MessagePackExtEnumValue:
+			{
+				Value response(Type::EnumValue);
+
+				response.set<StringType>(readString(length));
+
+				return response;
+			}
+
+			case MessagePackExtScalar:
+			{
+				const auto end = _offset + length;
+				Value response(Type::Scalar);
+
+				response.set<ScalarType>(decodeObject());
+
+				if (_offset != end)
+				{
+					throw std::runtime_error("Invalid MessagePack scalar extension");
+				}
+
+				return response;
+			}
+
+			default:
+				throw std::runtime_error("Unsupported MessagePack extension type");
+		}
+	}
+
+	Value decodeObject()
+	{
+		const auto format = next();
+
+		if (format <= msgpackPositiveFixIntMax)
+		{
+			return Value(static_cast<IntType>(format));
+		}
+		else if (format >= msgpackNegativeFixIntMin)
+		{
+			return Value(static_cast<IntType>(static_cast<std::int8_t>(format)));
+		}
+		else if ((format & ~msgpackFixMapMask) == msgpackFixMap)
+		{
+			return decodeMap(format & msgpackFixMapMask);
+		}
+		else if ((format & ~msgpackFixArrayMask) == msgpackFixArray)
+		{
+			return decodeList(format & msgpackFixArrayMask);
+		}
+		else if ((format & ~msgpackFixStrMask) == msgpackFixStr)
+		{
+			return Value(readString(format & msgpackFixStrMask));
+		}
+
+		switch (format)
+		{
+			case msgpackNil:
+				return Value();
+
+			case msgpackFalse:
+				return Value(false);
+
+			case msgpackTrue:
+				return Value(true);
+
+			case msgpackBin8:
+			case msgpackBin16:
+			case msgpackBin32:
+				throw std::runtime_error("MessagePack bin is not supported");
+
+			case msgpackExt8:
+				return decodeExt(static_cast<size_t>(readBigEndian(sizeof(std::uint8_t))));
+
+			case msgpackExt16:
+				return decodeExt(static_cast<size_t>(readBigEndian(sizeof(std::uint16_t))));
+
+			case msgpackExt32:
+				return decodeExt(static_cast<size_t>(readBigEndian(sizeof(std::uint32_t))));
+
+			case msgpackFloat32:
+			{
+				const auto bits = static_cast<std::uint32_t>(readBigEndian(sizeof(float)));
+				float value;
+
+				std::memcpy(&value, &bits, sizeof(value));
+
+				return makeFloat(static_cast<FloatType>(value));
+			}
+
+			case msgpackFloat64:
+			{
+				const auto bits = readBigEndian(sizeof(FloatType));
+				FloatType value;
+
+				std::memcpy(&value, &bits, sizeof(value));
+
+				return makeFloat(value);
+			}
+
+			case msgpackUint8:
+				return makeUnsigned(readBigEndian(sizeof(std::uint8_t)));
+
+			case msgpackUint16:
+				return makeUnsigned(readBigEndian(sizeof(std::uint16_t)));
+
+			case msgpackUint32:
+				return makeUnsigned(readBigEndian(sizeof(std::uint32_t)));
+
+			case msgpackUint64:
+				return makeUnsigned(readBigEndian(sizeof(std::uint64_t)));
+
+			case msgpackInt8:
+				return makeInt(
+					static_cast<std::int8_t>(readBigEndian(sizeof(std::int8_t))));
+
+			case msgpackInt16:
+				return makeInt(
+					static_cast<std::int16_t>(readBigEndian(sizeof(std::int16_t))));
+
+			case msgpackInt32:
+				return makeInt(
+					static_cast<std::int32_t>(readBigEndian(sizeof(std::int32_t))));
+
+			case msgpackInt64:
+				return makeInt(
+					static_cast<std::int64_t>(readBigEndian(sizeof(std::int64_t))));
+
+			case msgpackFixExt1:
+				return decodeExt(1);
+
+			case msgpackFixExt2:
+				return decodeExt(2);
+
+			case msgpackFixExt4:
+				return decodeExt(4);
+
+			case msgpackFixExt8:
+				return decodeExt(8);
+
+			case msgpackFixExt16:
+				return decodeExt(16);
+
+			case msgpackStr8:
+				return Value(readString(static_cast<size_t>(readBigEndian(sizeof(std::uint8_t)))));
+
+			case msgpackStr16:
+				return Value(
+					readString(static_cast<size_t>(readBigEndian(sizeof(std::uint16_t)))));
+
+			case msgpackStr32:
+				return Value(
+					readString(static_cast<size_t>(readBigEndian(sizeof(std::uint32_t)))));
+
+			case msgpackArray16:
+				return decodeList(static_cast<size_t>(readBigEndian(sizeof(std::uint16_t))));
+
+			case msgpackArray32:
+				return decodeList(static_cast<size_t>(readBigEndian(sizeof(std::uint32_t))));
+
+			case msgpackMap16:
+				return decodeMap(static_cast<size_t>(readBigEndian(sizeof(std::uint16_t))));
+
+			case msgpackMap32:
+				return decodeMap(static_cast<size_t>(readBigEndian(sizeof(std::uint32_t))));
+
+			default:
+				throw std::runtime_error("Invalid MessagePack format");
+		}
+	}
+
+	const std::vector<std::uint8_t>& _input;
+	size_t _offset = 0;
+};
+
+Value parseMessagePack(const std::vector<std::uint8_t>& msgpack)
+{
+	return MessagePackDecoder(msgpack).decode();
+}
+
+} /* namespace graphql::response */
@@ -0,0 +1,382 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "graphqlservice/PersistedQueries.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace graphql::service {
+
+namespace {
+
+using namespace std::literals;
+
+constexpr std::string_view strPersistedQueryNotFound { "PersistedQueryNotFound"sv };
+constexpr std::string_view strPersistedQueryHashMismatch { "PersistedQueryHashMismatch"sv };
+
+// https://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.180-4.pdf
+class Sha256
+{
+public:
+	void update(std::string_view input) noexcept
+	{
+		_length += input.size();
+
+		for (const auto ch : input)
+		{
+			_block[_blockSize++] = static_cast<uint8_t>(ch);
+
+			if (_blockSize == _block.size())
+			{
+				transform();
+				_blockSize = 0;
+			}
+		}
+	}
+
+	std::string hexDigest() noexcept
+	{
+		const uint64_t bitLength = static_cast<uint64_t>(_length) * 8;
+
+		_block[_blockSize++] = 0x80;
+
+		if (_blockSize > _block.size() - sizeof(bitLength))
+		{
+			std::fill(_block.begin() + _blockSize, _block.end(), uint8_t { 0 });
+			transform();
+			_blockSize = 0;
+		}
+
+		std::fill(_block.begin() + _blockSize, _block.end() - sizeof(bitLength), uint8_t { 0 });
+
+		for (size_t i = 0; i < sizeof(bitLength); ++i)
+		{
+			_block[_block.size() - 1 - i] = static_cast<uint8_t>(bitLength >> (i * 8));
+		}
+
+		transform();
+
+		constexpr char hexDigits[] = "0123456789abcdef";
+		std::string result;
+
+		result.reserve(_state.size() * 8);
+
+		for (const auto word : _state)
+		{
+			for (int shift = 28; shift >= 0; shift -= 4)
+			{
+				result.push_back(hexDigits[(word >> shift) & 0xF]);
+			}
+		}
+
+		return result;
+	}
+
+private:
+	static constexpr uint32_t rotateRight(uint32_t value, int bits) noexcept
+	{
+		return (value >> bits) | (value << (32 - bits));
+	}
+
+	void transform() noexcept
+	{
+		static constexpr std::array<uint32_t, 64> k { 0x428a2f98,
+			0x71374491,
+			0xb5c0fbcf,
+			0xe9b5dba5,
+			0x3956c25b,
+			0x59f111f1,
+			0x923f82a4,
+			0xab1c5ed5,
+			0xd807aa98,
+			0x12835b01,
+			0x243185be,
+			0x550c7dc3,
+			0x72be5d74,
+			0x80deb1fe,
+			0x9bdc06a7,
+			0xc19bf174,
+			0xe49b69c1,
+			0xefbe4786,
+			0x0fc19dc6,
+			0x240ca1cc,
+			0x2de92c6f,
+			0x4a7484aa,
+			0x5cb0a9dc,
+			0x76f988da,
+			0x983e5152,
+			0xa831c66d,
+			0xb00327c8,
+			0xbf597fc7,
+			0xc6e00bf3,
+			0xd5a79147,
+			0x06ca6351,
+			0x14292967,
+			0x27b70a85,
+			0x2e1b2138,
+			0x4d2c6dfc,
+			0x53380d13,
+			0x650a7354,
+			0x766a0abb,
+			0x81c2c92e,
+			0x92722c85,
+			0xa2bfe8a1,
+			0xa81a664b,
+			0xc24b8b70,
+			0xc76c51a3,
+			0xd192e819,
+			0xd6990624,
+			0xf40e3585,
+			0x106aa070,
+			0x19a4c116,
+			0x1e376c08,
+			0x2748774c,
+			0x34b0bcb5,
+			0x391c0cb3,
+			0x4ed8aa4a,
+			0x5b9cca4f,
+			0x682e6ff3,
+			0x748f82ee,
+			0x78a5636f,
+			0x84c87814,
+			0x8cc70208,
+			0x90befffa,
+			0xa4506ceb,
+			0xbef9a3f7,
+			0xc67178f2 };
+		std::array<uint32_t, 64> w;
+
+		for (size_t i = 0; i < 16; ++i)
+		{
+			w[i] = (static_cast<uint32_t>(_block[i * 4]) << 24)
+				| (static_cast<uint32_t>(_block[i * 4 + 1]) << 16)
+				| (static_cast<uint32_t>(_block[i * 4 + 2]) << 8)
+				| static_cast<uint32_t>(_block[i * 4 + 3]);
+		}
+
+		for (size_t i = 16; i < w.size(); ++i)
+		{
+			const auto s0 = rotateRight(w[i - 15], 7) ^ rotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+			const auto s1 = rotateRight(w[i - 2], 17) ^ rotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+
+			w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+		}
+
+		auto [a, b, c, d, e, f, g, h] = _state;
+
+		for (size_t i = 0; i < w.size(); ++i)
+		{
+			const auto s1 = rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25);
+			const auto choice = (e & f) ^ (~e & g);
+			const auto temp1 = h + s1 + choice + k[i] + w[i];
+			const auto s0 = rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22);
+			const auto majority = (a & b) ^ (a & c) ^ (b & c);
+			const auto temp2 = s0 + majority;
+
+			h = g;
+			g = f;
+			f = e;
+			e = d + temp1;
+			d = c;
+			c = b;
+			b = a;
+			a = temp1 + temp2;
+		}
+
+		_state[0] += a;
+		_state[1] += b;
+		_state[2] += c;
+		_state[3] += d;
+		_state[4] += e;
+		_state[5] += f;
+		_state[6] += g;
+		_state[7] += h;
+	}
+
+	std::array<uint32_t, 8> _state { 0x6a09e667,
+		0xbb67ae85,
+		0x3c6ef372,
+		0xa54ff53a,
+		0x510e527f,
+		0x9b05688c,
+		0x1f83d9ab,
+		0x5be0cd19 };
+	std::array<uint8_t, 64> _block {};
+	size_t _blockSize = 0;
+	size_t _length = 0;
+};
+
+} // namespace
+
+std::string hashQuery(std::string_view query)
+{
+	Sha256 hash;
+
+	hash.update(query);
+
+	return hash.hexDigest();
+}
+
+PersistedQueries::PersistedQueries(std::shared_ptr<const Request> service, size_t capacity)
+	: _service { std::move(service) }
+	, _capacity { std::max(capacity, size_t { 1 }) }
+{
+}
+
+std::string PersistedQueries::add(std::string_view query)
+{
+	auto id = hashQuery(query);
+
+	insert(std::string { id }, prepare(query));
+
+	return id;
+}
+
+void PersistedQueries::add(std::string id, std::string_view query)
+{
+	if (id != hashQuery(query))
+	{
+		throw schema_exception { { std::string { strPersistedQueryHashMismatch } } };
+	}
+
+	insert(std::move(id), prepare(query));
+}
+
+void PersistedQueries::addUnchecked(std::string id, std::string_view query)
+{
+	insert(std::move(id), prepare(query));
+}
+
+std::shared_ptr<peg::ast> PersistedQueries::find(const std::string& id)
+{
+	std::lock_guard lock { _entryMutex };
+	const auto itr = _index.find(id);
+
+	if (itr == _index.end())
+	{
+		return nullptr;
+	}
+
+	_entries.splice(_entries.begin(), _entries, itr->second);
+
+	return itr->second->second;
+}
+
+bool PersistedQueries::erase(const std::string& id)
+{
+	std::lock_guard lock { _entryMutex };
+	const auto itr = _index.find(id);
+
+	if (itr == _index.end())
+	{
+		return false;
+	}
+
+	_entries.erase(itr->second);
+	_index.erase(itr);
+
+	return true;
+}
+
+void PersistedQueries::clear()
+{
+	std::lock_guard lock { _entryMutex };
+
+	_index.clear();
+	_entries.clear();
+}
+
+size_t PersistedQueries::size() const
+{
+	std::lock_guard lock { _entryMutex };
+
+	return _entries.size();
+}
+
+size_t PersistedQueries::capacity() const noexcept
+{
+	return _capacity;
+}
+
+std::future<response::Value> PersistedQueries::resolve(const std::shared_ptr<RequestState>& state,
+	const std::string& id, const std::string& operationName, response::Value&& variables)
+{
+	return resolve(std::launch::deferred, nullptr, state, id, operationName, std::move(variables));
+}
+
+std::future<response::Value> PersistedQueries::resolve(std::launch launch,
+	const std::shared_ptr<RequestState>& state, const std::string& id,
+	const std::string& operationName, response::Value&& variables)
+{
+	return resolve(launch, nullptr, state, id, operationName, std::move(variables));
+}
+
+std::future<response::Value> PersistedQueries::resolve(const std::shared_ptr<Executor>& executor,
+	const std::shared_ptr<RequestState>& state, const std::string& id,
+	const std::string& operationName, response::Value&& variables)
+{
+	return resolve(std::launch::async, executor, state, id, operationName, std::move(variables));
+}
+
+std::future<response::Value> PersistedQueries::resolve(std::launch launch,
+	const std::shared_ptr<Executor>& executor, const std::shared_ptr<RequestState>& state,
+	const std::string& id, const std::string& operationName, response::Value&& variables)
+{
+	auto query = find(id);
+
+	if (!query)
+	{
+		std::promise<response::Value> promise;
+		response::Value document(response::Type::Map);
+
+		document.emplace_back(std::string { strData }, response::Value());
+		document.emplace_back(std::string { strErrors },
+			schema_exception { { std::string { strPersistedQueryNotFound } } }.getErrors());
+		promise.set_value(std::move(document));
+
+		return promise.get_future();
+	}
+
+	// The operation shares ownership of the AST until it's resolved, so it's safe to release the
+	// query even if it's evicted or the caller drops the future while a worker is still using it.
+	return executor
+		? _service->resolve(executor, state, *query, operationName, std::move(variables))
+		: _service->resolve(launch, state, *query, operationName, std::move(variables));
+}
+
+std::shared_ptr<peg::ast> PersistedQueries::prepare(std::string_view query) const
+{
+	auto ast = std::make_shared<peg::ast>(peg::parseString(query));
+
+	// Looking up the operation validates the query (throwing a schema_exception if it isn't valid)
+	// and compiles the execution plan up front, so Request::resolve never modifies the shared AST.
+	_service->findOperationDefinition(*ast, {});
+
+	return ast;
+}
+
+void PersistedQueries::insert(std::string&& id, std::shared_ptr<peg::ast>&& query)
+{
+	std::lock_guard lock { _entryMutex };
+	const auto itr = _index.find(id);
+
+	if (itr != _index.end())
+	{
+		itr->second->second = std::move(query);
+		_entries.splice(_entries.begin(), _entries, itr->second);
+		return;
+	}
+
+	_entries.emplace_front(id, std::move(query));
+	_index.emplace(std::move(id), _entries.begin());
+
+	while (_entries.size() > _capacity)
+	{
+		_index.erase(_entries.back().first);
+		_entries.pop_back();
+	}
+}
+
+} /* namespace graphql::service */
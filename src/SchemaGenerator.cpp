@@ -293,6 +293,18 @@ Generator::Generator(GeneratorOptions&& options)
 			directive @deprecated(
 				reason: String = "No longer supported"
 			) on FIELD_DEFINITION | ENUM_VALUE
+
+			# Incremental delivery directives, which are only handled by the overloads of
+			# Request::resolve that take an IncrementalCallback.
+			directive @defer(
+				label: String
+				if: Boolean! = true
+			) on FRAGMENT_SPREAD | INLINE_FRAGMENT
+			directive @stream(
+				label: String
+				if: Boolean! = true
+				initialCount: Int = 0
+			) on FIELD
 		)gql"sv);
 
 		if (!_ast.root)
@@ -312,6 +324,20 @@ Generator::Generator(GeneratorOptions&& options)
 		}
 	}
 
+	if (_ast.hasExecutableDefinitions)
+	{
+		// Fail before visiting any of the type definitions, visitDefinition throws for the first
+		// executable definition.
+		for (const auto& child : _ast.root->children)
+		{
+			if (child->is_type<peg::operation_definition>()
+				|| child->is_type<peg::fragment_definition>())
+			{
+				visitDefinition(*child);
+			}
+		}
+	}
+
 	for (const auto& child : _ast.root->children)
 	{
 		visitDefinition(*child);
@@ -1472,7 +1498,7 @@ void Generator::DefaultValueVisitor::visitFloatValue(const peg::ast_node& floatV
 
 void Generator::DefaultValueVisitor::visitStringValue(const peg::ast_node& stringValue)
 {
-	_value = response::Value(std::string { stringValue.unescaped_view() });
+	_value = response::Value(stringValue.unescaped());
 }
 
 void Generator::DefaultValueVisitor::visitBooleanValue(const peg::ast_node& booleanValue)
@@ -1975,7 +2001,7 @@ void Generator::outputObjectDeclaration(
 {
 protected:
 	explicit )cpp"
-			   << objectType.cppType << R"cpp(();
+			   << objectType.cppType << R"cpp((bool threadSafe = false);
 )cpp";
 
 	if (!objectType.fields.empty())
@@ -2010,15 +2036,25 @@ private:
 		}
 
 		headerFile << R"cpp(
-	std::future<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_typename(service::ResolverParams&& params);
 )cpp";
 
 		if (!_options.noIntrospection && isQueryType)
 		{
 			headerFile
-				<< R"cpp(	std::future<service::ResolverResult> resolve_schema(service::ResolverParams&& params);
-	std::future<service::ResolverResult> resolve_type(service::ResolverParams&& params);
+				<< R"cpp(	service::FieldResult<service::ResolverResult> resolve_schema(service::ResolverParams&& params);
+	service::FieldResult<service::ResolverResult> resolve_type(service::ResolverParams&& params);
+)cpp";
+		}
+
+		headerFile << R"cpp(
+	static const service::TypeNames& getTypeNames() noexcept;
+	static const service::FieldResolverMap& getResolvers() noexcept;
+)cpp";
 
+		if (!_options.noIntrospection && isQueryType)
+		{
+			headerFile << R"cpp(
 	std::shared_ptr<schema::Schema> _schema;
 )cpp";
 		}
@@ -2074,7 +2110,7 @@ std::string Generator::getResolverDeclaration(const OutputField& outputField) co
 	std::string fieldName(outputField.cppName);
 
 	fieldName[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(fieldName[0])));
-	output << R"cpp(	std::future<service::ResolverResult> resolve)cpp" << fieldName
+	output << R"cpp(	service::FieldResult<service::ResolverResult> resolve)cpp" << fieldName
 		   << R"cpp((service::ResolverParams&& params);
 )cpp";
 
@@ -2176,7 +2212,7 @@ template <>
 }
 
 template <>
-std::future<service::ResolverResult> ModifiedResult<)cpp"
+service::FieldResult<service::ResolverResult> ModifiedResult<)cpp"
 					   << _schemaNamespace << R"cpp(::)cpp" << enumType.cppType
 					   << R"cpp(>::convert(service::FieldResult<)cpp" << _schemaNamespace
 					   << R"cpp(::)cpp" << enumType.cppType
@@ -2218,7 +2254,7 @@ std::future<service::ResolverResult> ModifiedResult<)cpp"
 					if (firstField)
 					{
 						firstField = false;
-						sourceFile << R"cpp(	const auto defaultValue = []()
+						sourceFile << R"cpp(	static const auto defaultValue = []()
 	{
 		response::Value values(response::Type::Map);
 		response::Value entry;
@@ -2888,10 +2924,26 @@ void Generator::outputObjectImplementation(
 	using namespace std::literals;
 
 	// Output the protected constructor which calls through to the service::Object constructor
-	// with arguments that declare the set of types it implements and bind the fields to the
-	// resolver methods.
-	sourceFile << objectType.cppType << R"cpp(::)cpp" << objectType.cppType << R"cpp(()
-	: service::Object({
+	// with the static tables that declare the set of types it implements and bind the fields to
+	// the resolver methods.
+	sourceFile << objectType.cppType << R"cpp(::)cpp" << objectType.cppType
+			   << R"cpp((bool threadSafe)
+	: service::Object(getTypeNames(), getResolvers(), threadSafe))cpp";
+
+	if (!_options.noIntrospection && isQueryType)
+	{
+		sourceFile << R"cpp(
+	, _schema(GetSchema()))cpp";
+	}
+
+	sourceFile << R"cpp(
+{
+}
+
+const service::TypeNames& )cpp"
+			   << objectType.cppType << R"cpp(::getTypeNames() noexcept
+{
+	static const service::TypeNames s_typeNames {
 )cpp";
 
 	for (const auto& interfaceName : objectType.interfaces)
@@ -2907,7 +2959,15 @@ void Generator::outputObjectImplementation(
 	}
 
 	sourceFile << R"cpp(		")cpp" << objectType.type << R"cpp("
-	}, {
+	};
+
+	return s_typeNames;
+}
+
+const service::FieldResolverMap& )cpp"
+			   << objectType.cppType << R"cpp(::getResolvers() noexcept
+{
+	static const service::FieldResolverMap s_resolvers {
 )cpp";
 
 	std::map<std::string_view, std::string, internal::shorter_or_less> resolvers;
@@ -2915,7 +2975,7 @@ void Generator::outputObjectImplementation(
 	std::transform(objectType.fields.cbegin(),
 		objectType.fields.cend(),
 		std::inserter(resolvers, resolvers.begin()),
-		[](const OutputField& outputField) noexcept {
+		[&objectType](const OutputField& outputField) noexcept {
 			std::string fieldName(outputField.cppName);
 
 			fieldName[0] =
@@ -2924,21 +2984,30 @@ void Generator::outputObjectImplementation(
 			std::ostringstream output;
 
 			output << R"cpp(		{ R"gql()cpp" << outputField.name
-				   << R"cpp()gql"sv, [this](service::ResolverParams&& params) { return resolve)cpp"
-				   << fieldName << R"cpp((std::move(params)); } })cpp";
+				   << R"cpp()gql"sv, service::dispatchField<)cpp" << objectType.cppType
+				   << R"cpp(, &)cpp" << objectType.cppType << R"cpp(::resolve)cpp" << fieldName
+				   << R"cpp(> })cpp";
 
 			return std::make_pair(std::string_view { outputField.name }, output.str());
 		});
 
-	resolvers["__typename"sv] =
-		R"cpp(		{ R"gql(__typename)gql"sv, [this](service::ResolverParams&& params) { return resolve_typename(std::move(params)); } })cpp"s;
+	const auto getIntrospectionResolver = [&objectType](std::string_view fieldName,
+											  std::string_view resolverName) noexcept {
+		std::ostringstream output;
+
+		output << R"cpp(		{ R"gql()cpp" << fieldName << R"cpp()gql"sv, service::dispatchField<)cpp"
+			   << objectType.cppType << R"cpp(, &)cpp" << objectType.cppType << R"cpp(::)cpp"
+			   << resolverName << R"cpp(> })cpp";
+
+		return output.str();
+	};
+
+	resolvers["__typename"sv] = getIntrospectionResolver("__typename"sv, "resolve_typename"sv);
 
 	if (!_options.noIntrospection && isQueryType)
 	{
-		resolvers["__schema"sv] =
-			R"cpp(		{ R"gql(__schema)gql"sv, [this](service::ResolverParams&& params) { return resolve_schema(std::move(params)); } })cpp"s;
-		resolvers["__type"sv] =
-			R"cpp(		{ R"gql(__type)gql"sv, [this](service::ResolverParams&& params) { return resolve_type(std::move(params)); } })cpp"s;
+		resolvers["__schema"sv] = getIntrospectionResolver("__schema"sv, "resolve_schema"sv);
+		resolvers["__type"sv] = getIntrospectionResolver("__type"sv, "resolve_type"sv);
 	}
 
 	bool firstField = true;
@@ -2956,16 +3025,9 @@ void Generator::outputObjectImplementation(
 	}
 
 	sourceFile << R"cpp(
-	}))cpp";
-
-	if (!_options.noIntrospection && isQueryType)
-	{
-		sourceFile << R"cpp(
-	, _schema(GetSchema()))cpp";
-	}
+	};
 
-	sourceFile << R"cpp(
-{
+	return s_resolvers;
 }
 )cpp";
 
@@ -2998,7 +3060,7 @@ service::FieldResult<)cpp"
 		}
 
 		sourceFile << R"cpp(
-std::future<service::ResolverResult> )cpp"
+service::FieldResult<service::ResolverResult> )cpp"
 				   << objectType.cppType << R"cpp(::resolve)cpp" << fieldName
 				   << R"cpp((service::ResolverParams&& params)
 {
@@ -3016,7 +3078,7 @@ std::future<service::ResolverResult> )cpp"
 					if (firstArgument)
 					{
 						firstArgument = false;
-						sourceFile << R"cpp(	const auto defaultArguments = []()
+						sourceFile << R"cpp(	static const auto defaultArguments = []()
 	{
 		response::Value values(response::Type::Map);
 		response::Value entry;
@@ -3049,11 +3111,11 @@ std::future<service::ResolverResult> )cpp"
 			}
 		}
 
-		sourceFile << R"cpp(	std::unique_lock resolverLock(_resolverMutex);
+		sourceFile << R"cpp(	auto resolverLock = lockResolver();
 	auto directives = std::move(params.fieldDirectives);
-	auto result = )cpp"
-				   << outputField.accessor << fieldName
-				   << R"cpp((service::FieldParams(std::move(params), std::move(directives)))cpp";
+	auto result = service::invokeAccessor(*this, &)cpp"
+				   << objectType.cppType << R"cpp(::)cpp" << outputField.accessor << fieldName
+				   << R"cpp(, service::FieldParams(std::move(params), std::move(directives)))cpp";
 
 		if (!outputField.arguments.empty())
 		{
@@ -3068,7 +3130,11 @@ std::future<service::ResolverResult> )cpp"
 		}
 
 		sourceFile << R"cpp();
-	resolverLock.unlock();
+
+	if (resolverLock)
+	{
+		resolverLock.unlock();
+	}
 
 	return )cpp" << getResultAccessType(outputField)
 				   << R"cpp(::convert)cpp" << getTypeModifiers(outputField.modifiers)
@@ -3078,7 +3144,7 @@ std::future<service::ResolverResult> )cpp"
 	}
 
 	sourceFile << R"cpp(
-std::future<service::ResolverResult> )cpp"
+service::FieldResult<service::ResolverResult> )cpp"
 			   << objectType.cppType << R"cpp(::resolve_typename(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<response::StringType>::convert(response::StringType{ R"gql()cpp"
@@ -3090,14 +3156,14 @@ std::future<service::ResolverResult> )cpp"
 	{
 		sourceFile
 			<< R"cpp(
-std::future<service::ResolverResult> )cpp"
+service::FieldResult<service::ResolverResult> )cpp"
 			<< objectType.cppType << R"cpp(::resolve_schema(service::ResolverParams&& params)
 {
 	return service::ModifiedResult<service::Object>::convert(std::static_pointer_cast<service::Object>(std::make_shared<)cpp"
 			<< s_introspectionNamespace << R"cpp(::Schema>(_schema)), std::move(params));
 }
 
-std::future<service::ResolverResult> )cpp"
+service::FieldResult<service::ResolverResult> )cpp"
 			<< objectType.cppType << R"cpp(::resolve_type(service::ResolverParams&& params)
 {
 	auto argName = service::ModifiedArgument<response::StringType>::require("name", params.arguments);
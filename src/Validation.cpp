@@ -355,52 +355,66 @@ ValidateType ValidateVariableTypeVisitor::getType()
 	return result;
 }
 
-ValidateExecutableVisitor::ValidateExecutableVisitor(const std::shared_ptr<schema::Schema>& schema)
-	: _schema(schema)
+constexpr bool isScalarType(introspection::TypeKind kind) noexcept
 {
-	const auto& queryType = _schema->queryType();
-	const auto& mutationType = _schema->mutationType();
-	const auto& subscriptionType = _schema->subscriptionType();
+	switch (kind)
+	{
+		case introspection::TypeKind::OBJECT:
+		case introspection::TypeKind::INTERFACE:
+		case introspection::TypeKind::UNION:
+			return false;
 
-	_operationTypes.reserve(3);
+		default:
+			return true;
+	}
+}
+
+ValidationContext::ValidationContext(const std::shared_ptr<schema::Schema>& schema)
+	: schema(schema)
+{
+	const auto& queryType = schema->queryType();
+	const auto& mutationType = schema->mutationType();
+	const auto& subscriptionType = schema->subscriptionType();
+
+	operationTypes.reserve(3);
 
 	if (mutationType)
 	{
-		_operationTypes[strMutation] = getValidateType(mutationType);
+		operationTypes[strMutation] = getValidateType(mutationType);
 	}
 
 	if (queryType)
 	{
-		_operationTypes[strQuery] = getValidateType(queryType);
+		operationTypes[strQuery] = getValidateType(queryType);
 	}
 
 	if (subscriptionType)
 	{
-		_operationTypes[strSubscription] = getValidateType(subscriptionType);
+		operationTypes[strSubscription] = getValidateType(subscriptionType);
 	}
 
-	const auto& types = _schema->types();
+	const auto& schemaTypes = schema->types();
 
-	_types.reserve(types.size());
+	types.reserve(schemaTypes.size());
 
-	for (const auto& entry : types)
+	for (const auto& entry : schemaTypes)
 	{
 		const auto name = entry.first;
 		const auto kind = entry.second->kind();
 
 		if (!isScalarType(kind))
 		{
-			auto matchingTypes = std::move(_matchingTypes[name]);
+			auto typeMatchingTypes = std::move(matchingTypes[name]);
 
 			if (kind == introspection::TypeKind::OBJECT)
 			{
-				matchingTypes.emplace(name);
+				typeMatchingTypes.emplace(name);
 			}
 			else
 			{
 				const auto& possibleTypes = entry.second->possibleTypes();
 
-				matchingTypes.reserve(possibleTypes.size());
+				typeMatchingTypes.reserve(possibleTypes.size());
 
 				for (const auto& possibleType : possibleTypes)
 				{
@@ -408,24 +422,24 @@ ValidateExecutableVisitor::ValidateExecutableVisitor(const std::shared_ptr<schem
 
 					if (spType)
 					{
-						matchingTypes.emplace(spType->name());
+						typeMatchingTypes.emplace(spType->name());
 					}
 				}
 			}
 
-			if (!matchingTypes.empty())
+			if (!typeMatchingTypes.empty())
 			{
-				_matchingTypes[name] = std::move(matchingTypes);
+				matchingTypes[name] = std::move(typeMatchingTypes);
 			}
 		}
 		else if (kind == introspection::TypeKind::ENUM)
 		{
-			const auto& enumValues = entry.second->enumValues();
+			const auto& typeEnumValues = entry.second->enumValues();
 			internal::string_view_set values;
 
-			values.reserve(enumValues.size());
+			values.reserve(typeEnumValues.size());
 
-			for (const auto& value : enumValues)
+			for (const auto& value : typeEnumValues)
 			{
 				if (value)
 				{
@@ -433,24 +447,24 @@ ValidateExecutableVisitor::ValidateExecutableVisitor(const std::shared_ptr<schem
 				}
 			}
 
-			if (!enumValues.empty())
+			if (!typeEnumValues.empty())
 			{
-				_enumValues[name] = std::move(values);
+				enumValues[name] = std::move(values);
 			}
 		}
 		else if (kind == introspection::TypeKind::SCALAR)
 		{
-			_scalarTypes.emplace(name);
+			scalarTypes.emplace(name);
 		}
 
-		_types[name] = getValidateType(entry.second);
+		types[name] = getValidateType(entry.second);
 	}
 
-	const auto& directives = _schema->directives();
+	const auto& schemaDirectives = schema->directives();
 
-	_directives.reserve(directives.size());
+	directives.reserve(schemaDirectives.size());
 
-	for (const auto& directive : directives)
+	for (const auto& directive : schemaDirectives)
 	{
 		const auto name = directive->name();
 		const auto& locations = directive->locations();
@@ -463,8 +477,119 @@ ValidateExecutableVisitor::ValidateExecutableVisitor(const std::shared_ptr<schem
 		}
 
 		validateDirective.arguments = getArguments(args);
-		_directives[name] = std::move(validateDirective);
+		directives[name] = std::move(validateDirective);
+	}
+
+	// Build the field and argument tables for every type up front instead of lazily filling them
+	// in during validation, so concurrent visitors never modify them.
+	for (const auto& entry : schemaTypes)
+	{
+		const auto& type = *entry.second;
+		const auto kind = type.kind();
+
+		if (!isScalarType(kind))
+		{
+			typeFields.emplace(entry.first, getTypeFields(type));
+		}
+		else if (kind == introspection::TypeKind::INPUT_OBJECT)
+		{
+			inputTypeFields.emplace(entry.first, getArguments(type.inputFields()));
+		}
+	}
+}
+
+ValidateTypeFieldArguments ValidationContext::getArguments(
+	const std::vector<std::shared_ptr<const schema::InputValue>>& args)
+{
+	ValidateTypeFieldArguments result;
+
+	for (const auto& arg : args)
+	{
+		if (!arg)
+		{
+			continue;
+		}
+
+		ValidateArgument argument;
+
+		argument.defaultValue = !arg->defaultValue().empty();
+		argument.nonNullDefaultValue =
+			argument.defaultValue && arg->defaultValue() != R"gql(null)gql"sv;
+		argument.type = getValidateType(arg->type().lock());
+
+		result[arg->name()] = std::move(argument);
+	}
+
+	return result;
+}
+
+ValidationContext::FieldTypes ValidationContext::getTypeFields(const schema::BaseType& type) const
+{
+	const auto& fields = type.fields();
+	FieldTypes validateFields;
+
+	for (auto& entry : fields)
+	{
+		if (!entry)
+		{
+			continue;
+		}
+
+		const auto fieldName = entry->name();
+		ValidateTypeField subField;
+
+		subField.returnType = getValidateType(entry->type().lock());
+
+		if (fieldName.empty() || !subField.returnType)
+		{
+			continue;
+		}
+
+		subField.arguments = getArguments(entry->args());
+
+		validateFields[fieldName] = std::move(subField);
 	}
+
+	if (schema->supportsIntrospection() && &type == schema->queryType().get())
+	{
+		ValidateTypeField schemaField;
+
+		schemaField.returnType = getValidateType(schema->WrapType(introspection::TypeKind::NON_NULL,
+			schema->LookupType(R"gql(__Schema)gql"sv)));
+		validateFields[R"gql(__schema)gql"sv] = std::move(schemaField);
+
+		ValidateTypeField typeField;
+		ValidateArgument nameArgument;
+
+		typeField.returnType = getValidateType(schema->LookupType(R"gql(__Type)gql"sv));
+
+		nameArgument.type = getValidateType(schema->WrapType(introspection::TypeKind::NON_NULL,
+			schema->LookupType(R"gql(String)gql"sv)));
+		typeField.arguments[R"gql(name)gql"sv] = std::move(nameArgument);
+
+		validateFields[R"gql(__type)gql"sv] = std::move(typeField);
+	}
+
+	ValidateTypeField typenameField;
+
+	typenameField.returnType = getValidateType(schema->WrapType(introspection::TypeKind::NON_NULL,
+		schema->LookupType(R"gql(String)gql"sv)));
+	validateFields[R"gql(__typename)gql"sv] = std::move(typenameField);
+
+	return validateFields;
+}
+
+ValidateExecutableVisitor::ValidateExecutableVisitor(const ValidationContext& context)
+	: _schema(context.schema)
+	, _operationTypes(context.operationTypes)
+	, _types(context.types)
+	, _matchingTypes(context.matchingTypes)
+	, _directives(context.directives)
+	, _enumValues(context.enumValues)
+	, _scalarTypes(context.scalarTypes)
+	, _typeFields(context.typeFields)
+	, _inputTypeFields(context.inputTypeFields)
+{
 }
 
 void ValidateExecutableVisitor::visit(const peg::ast_node& root)
@@ -580,12 +705,6 @@ std::list<schema_error> ValidateExecutableVisitor::getStructuredErrors()
 {
 	auto errors = std::move(_errors);
 
-	// Reset all of the state for this query, but keep the Introspection schema information.
-	_fragmentDefinitions.clear();
-	_operationDefinitions.clear();
-	_referencedFragments.clear();
-	_fragmentCycles.clear();
-
 	return errors;
 }
 
@@ -834,45 +953,6 @@ void ValidateExecutableVisitor::visitSelection(const peg::ast_node& selection)
 	}
 }
 
-ValidateTypeFieldArguments ValidateExecutableVisitor::getArguments(
-	const std::vector<std::shared_ptr<const schema::InputValue>>& args)
-{
-	ValidateTypeFieldArguments result;
-
-	for (const auto& arg : args)
-	{
-		if (!arg)
-		{
-			continue;
-		}
-
-		ValidateArgument argument;
-
-		argument.defaultValue = !arg->defaultValue().empty();
-		argument.nonNullDefaultValue =
-			argument.defaultValue && arg->defaultValue() != R"gql(null)gql"sv;
-		argument.type = getValidateType(arg->type().lock());
-
-		result[arg->name()] = std::move(argument);
-	}
-
-	return result;
-}
-
-constexpr bool ValidateExecutableVisitor::isScalarType(introspection::TypeKind kind)
-{
-	switch (kind)
-	{
-		case introspection::TypeKind::OBJECT:
-		case introspection::TypeKind::INTERFACE:
-		case introspection::TypeKind::UNION:
-			return false;
-
-		default:
-			return true;
-	}
-}
-
 bool ValidateExecutableVisitor::matchesScopedType(std::string_view name) const
 {
 	if (name == _scopedType->get().name())
@@ -1390,91 +1470,15 @@ bool ValidateExecutableVisitor::validateVariableType(bool isNonNull,
 }
 
 ValidateExecutableVisitor::TypeFields::const_iterator ValidateExecutableVisitor::
-	getScopedTypeFields()
+	getScopedTypeFields() const
 {
-	auto typeKind = _scopedType->get().kind();
-	auto itrType = _typeFields.find(_scopedType->get().name());
-
-	if (itrType == _typeFields.end() && !isScalarType(typeKind))
-	{
-		const auto& fields = _scopedType->get().fields();
-		internal::string_view_map<ValidateTypeField> validateFields;
-
-		for (auto& entry : fields)
-		{
-			if (!entry)
-			{
-				continue;
-			}
-
-			const auto fieldName = entry->name();
-			ValidateTypeField subField;
-
-			subField.returnType = getValidateType(entry->type().lock());
-
-			if (fieldName.empty() || !subField.returnType)
-			{
-				continue;
-			}
-
-			subField.arguments = getArguments(entry->args());
-
-			validateFields[fieldName] = std::move(subField);
-		}
-
-		if (_schema->supportsIntrospection() && _scopedType == _operationTypes[strQuery])
-		{
-			ValidateTypeField schemaField;
-
-			schemaField.returnType =
-				getValidateType(_schema->WrapType(introspection::TypeKind::NON_NULL,
-					_schema->LookupType(R"gql(__Schema)gql"sv)));
-			validateFields[R"gql(__schema)gql"sv] = std::move(schemaField);
-
-			ValidateTypeField typeField;
-			ValidateArgument nameArgument;
-
-			typeField.returnType = getValidateType(_schema->LookupType(R"gql(__Type)gql"sv));
-
-			nameArgument.type = getValidateType(_schema->WrapType(introspection::TypeKind::NON_NULL,
-				_schema->LookupType(R"gql(String)gql"sv)));
-			typeField.arguments[R"gql(name)gql"sv] = std::move(nameArgument);
-
-			validateFields[R"gql(__type)gql"sv] = std::move(typeField);
-		}
-
-		ValidateTypeField typenameField;
-
-		typenameField.returnType =
-			getValidateType(_schema->WrapType(introspection::TypeKind::NON_NULL,
-				_schema->LookupType(R"gql(String)gql"sv)));
-		validateFields[R"gql(__typename)gql"sv] = std::move(typenameField);
-
-		itrType = _typeFields.emplace(_scopedType->get().name(), std::move(validateFields)).first;
-	}
-
-	return itrType;
+	return _typeFields.find(_scopedType->get().name());
 }
 
 ValidateExecutableVisitor::InputTypeFields::const_iterator ValidateExecutableVisitor::
-	getInputTypeFields(std::string_view name)
+	getInputTypeFields(std::string_view name) const
 {
-	auto itrFields = _inputTypeFields.find(name);
-
-	if (itrFields == _inputTypeFields.end())
-	{
-		auto itrType = _types.find(name);
-
-		if (itrType != _types.end()
-			&& itrType->second->get().kind() == introspection::TypeKind::INPUT_OBJECT)
-		{
-			itrFields =
-				_inputTypeFields.emplace(name, getArguments(itrType->second->get().inputFields()))
-					.first;
-		}
-	}
-
-	return itrFields;
+	return _inputTypeFields.find(name);
 }
 
 template <class _FieldTypes>
@@ -7,6 +7,8 @@
 
 #include <tao/pegtl/contrib/analyze.hpp>
 
+#include <thread>
+
 using namespace graphql;
 using namespace graphql::peg;
 
@@ -339,6 +341,304 @@ TEST(PegtlCase, ParseVariableDefaultEmptyList)
 	ASSERT_TRUE(result) << "we should be able to parse the doc";
 }
 
+TEST(PegtlCase, SelectedRulesHaveIds)
+{
+	auto ast = parseString(R"gql(
+		schema { query: Query }
+		"Description"
+		type Query implements Node @deprecated(reason: "none") {
+			id: ID!
+			items(first: Int = 1, filter: [String!]): [Item]
+		}
+		union Item = Query
+		enum Color { RED GREEN }
+		input Filter { name: String }
+		directive @tag(name: String) on FIELD | QUERY
+		extend type Query { more: Boolean }
+
+		query Everything($first: Int = 2, $obj: Filter = { name: "abc" }) {
+			alias: items(first: $first, filter: ["x", """block"""]) @skip(if: false) {
+				...ItemFields
+				... on Query { id }
+			}
+			color(value: RED, number: 1.5, flag: true, nothing: null)
+		}
+		fragment ItemFields on Query { id })gql");
+	std::function<void(const ast_node&)> visitNode = [&visitNode](const ast_node& node) {
+		for (const auto& child : node.children)
+		{
+			EXPECT_NE(ast_rule::none, child->rule())
+				<< "every selected node should have a rule ID: " << child->string();
+			visitNode(*child);
+		}
+	};
+
+	ASSERT_TRUE(ast.root != nullptr) << "we should be able to parse the doc";
+	EXPECT_TRUE(ast.root->is_root()) << "the root node does not match a rule";
+	EXPECT_FALSE(ast.root->is_type<name>()) << "unselected rules should not match the root node";
+	EXPECT_TRUE(ast.root->children.front()->is_type<schema_definition>());
+	EXPECT_TRUE(ast.root->children.back()->is_type<fragment_definition>());
+	visitNode(*ast.root);
+}
+
+TEST(PegtlCase, ParseMixedDefinitionKinds)
+{
+	auto query = parseString(R"gql(
+		query { id })gql");
+	auto mixed = parseString(R"gql(
+		type Query { id: ID! }
+		query { id })gql");
+	auto schema = parseSchemaString(R"gql(
+		type Query { id: ID! })gql");
+
+	ASSERT_TRUE(query.root && mixed.root && schema.root) << "we should be able to parse the docs";
+	EXPECT_TRUE(query.hasExecutableDefinitions);
+	EXPECT_FALSE(query.hasTypeSystemDefinitions);
+	EXPECT_TRUE(mixed.hasExecutableDefinitions);
+	EXPECT_TRUE(mixed.hasTypeSystemDefinitions);
+	ASSERT_EQ(size_t { 2 }, mixed.root->children.size());
+	EXPECT_TRUE(mixed.root->children.front()->is_type<object_type_definition>());
+	EXPECT_TRUE(mixed.root->children.back()->is_type<operation_definition>());
+	EXPECT_FALSE(schema.hasExecutableDefinitions);
+	EXPECT_TRUE(schema.hasTypeSystemDefinitions);
+}
+
+TEST(PegtlCase, ParseWithoutCopying)
+{
+	std::string owned { R"gql(query OwnedQuery { appointments { edges { node { id } } } })gql" };
+	std::vector<char> ownedVector { owned.cbegin(), owned.cend() };
+	const std::string borrowed { owned };
+	const auto ownedData = owned.data();
+	const auto ownedVectorData = ownedVector.data();
+
+	auto ownedAst = parseString(std::move(owned));
+	auto ownedVectorAst = parseString(std::move(ownedVector));
+	auto borrowedAst = parseBorrowedString(borrowed);
+
+	ASSERT_TRUE(ownedAst.root && ownedVectorAst.root && borrowedAst.root)
+		<< "we should be able to parse the docs";
+	EXPECT_EQ(ownedData, ownedAst.root->children.front()->string_view().data())
+		<< "the moved std::string should be parsed in place";
+	EXPECT_EQ(ownedVectorData, ownedVectorAst.root->children.front()->string_view().data())
+		<< "the moved std::vector<char> should be parsed in place";
+	EXPECT_EQ(borrowed.data(), borrowedAst.root->children.front()->string_view().data())
+		<< "the borrowed buffer should be parsed in place";
+}
+
+TEST(PegtlCase, LazyNodePositions)
+{
+	auto ast = parseString("query {\n  first\n\n    second }\r\nfragment F on Query { id }");
+
+	ASSERT_TRUE(ast.root != nullptr) << "we should be able to parse the doc";
+	ASSERT_EQ(size_t { 2 }, ast.root->children.size());
+
+	const auto& operation = *ast.root->children.front();
+	const auto& fragment = *ast.root->children.back();
+	const auto& selectionSet = *operation.children.back();
+
+	ASSERT_TRUE(selectionSet.is_type<selection_set>());
+	ASSERT_EQ(size_t { 2 }, selectionSet.children.size());
+
+	const auto first = selectionSet.children.front()->begin();
+	const auto second = selectionSet.children.back()->begin();
+	const auto fragmentPosition = fragment.begin();
+
+	EXPECT_EQ(size_t { 2 }, first.line);
+	EXPECT_EQ(size_t { 3 }, first.column);
+	EXPECT_EQ(size_t { 10 }, first.byte);
+	EXPECT_EQ(size_t { 4 }, second.line);
+	EXPECT_EQ(size_t { 5 }, second.column);
+	EXPECT_EQ(size_t { 5 }, fragmentPosition.line);
+	EXPECT_EQ(size_t { 1 }, fragmentPosition.column);
+	EXPECT_EQ("GraphQL", fragmentPosition.source);
+}
+
+TEST(PegtlCase, ScanCharacterRuns)
+{
+	const std::string padding(70, ' ');
+	const std::string text(70, 'x');
+	const auto ignored = padding + ",\t\r\n\v\f" + padding + "x";
+	const auto string = text + "\t" + text + "\"";
+	const auto block = text + "\r\n" + text + "\\";
+	const auto unicode = text + "\xC3\xA9";
+
+	EXPECT_EQ(ignored.size() - 1,
+		scan_run(scan_class::ignored, ignored.data(), ignored.data() + ignored.size()));
+	EXPECT_EQ(string.size() - 1,
+		scan_run(scan_class::string_character, string.data(), string.data() + string.size()));
+	EXPECT_EQ(text.size(),
+		scan_run(scan_class::string_character, block.data(), block.data() + block.size()))
+		<< "line terminators are not allowed in quoted strings";
+	EXPECT_EQ(block.size() - 1,
+		scan_run(scan_class::block_string_character, block.data(), block.data() + block.size()));
+	EXPECT_EQ(text.size(),
+		scan_run(scan_class::string_character, unicode.data(), unicode.data() + unicode.size()))
+		<< "UTF-8 sequences are left for the spec rules";
+	EXPECT_EQ(size_t { 0 },
+		scan_run(scan_class::ignored, text.data(), text.data() + text.size()));
+}
+
+TEST(PegtlCase, ParseLongStrings)
+{
+	const std::string text(100, 'x');
+	auto ast = parseString("# " + text + "\r\n{ field(quoted: \"" + text
+		+ "\xC3\xA9\\n\\u0041" + text + "\", block: \"\"\"" + text + "\n\\\"\"\"" + text
+		+ "\"\"\") }");
+
+	ASSERT_TRUE(ast.root != nullptr) << "we should be able to parse the doc";
+
+	std::vector<std::string> values;
+	std::function<void(const ast_node&)> visitNode = [&](const ast_node& node) {
+		if (node.is_type<string_value>())
+		{
+			values.push_back(std::string { node.unescaped_view() });
+			return;
+		}
+
+		for (const auto& child : node.children)
+		{
+			visitNode(*child);
+		}
+	};
+
+	visitNode(*ast.root);
+
+	ASSERT_EQ(size_t { 2 }, values.size());
+	EXPECT_EQ(text + "\xC3\xA9\nA" + text, values.front());
+	EXPECT_EQ(text + "\n\"\"\"" + text, values.back());
+}
+
+TEST(PegtlCase, UnescapeStrings)
+{
+	auto ast = parseString(
+		R"gql({ field(plain: "no escapes", escaped: "a\u00e9\uD83D\uDE00\t\"b", empty: "") })gql");
+
+	ASSERT_TRUE(ast.root != nullptr) << "we should be able to parse the doc";
+
+	std::vector<const ast_node*> values;
+	std::function<void(const ast_node&)> visitNode = [&](const ast_node& node) {
+		if (node.is_type<string_value>())
+		{
+			values.push_back(&node);
+			return;
+		}
+
+		for (const auto& child : node.children)
+		{
+			visitNode(*child);
+		}
+	};
+
+	visitNode(*ast.root);
+
+	ASSERT_EQ(size_t { 3 }, values.size());
+
+	const auto& plain = *values[0];
+	const auto& escaped = *values[1];
+	const auto& empty = *values[2];
+
+	EXPECT_EQ("no escapes", plain.unescaped());
+	EXPECT_EQ(plain.string_view().data() + 1, plain.unescaped_view().data())
+		<< "strings without escape sequences should be views of the source";
+	EXPECT_EQ("a\xC3\xA9\xF0\x9F\x98\x80\t\"b", escaped.unescaped())
+		<< "unescaped should not need to cache the value";
+	EXPECT_EQ("a\xC3\xA9\xF0\x9F\x98\x80\t\"b", escaped.unescaped_view());
+	EXPECT_EQ("a\xC3\xA9\xF0\x9F\x98\x80\t\"b", escaped.unescaped())
+		<< "unescaped should match the cached value";
+	EXPECT_TRUE(empty.unescaped().empty());
+	EXPECT_TRUE(empty.unescaped_view().empty());
+}
+
+TEST(PegtlCase, UnescapeStringsConcurrently)
+{
+	auto ast = parseString(R"gql({ field(escaped: "a\u00e9\uD83D\uDE00\t\"b") })gql");
+
+	ASSERT_TRUE(ast.root != nullptr) << "we should be able to parse the doc";
+
+	const ast_node* escaped = nullptr;
+	std::function<void(const ast_node&)> visitNode = [&](const ast_node& node) {
+		if (node.is_type<string_value>())
+		{
+			escaped = &node;
+			return;
+		}
+
+		for (const auto& child : node.children)
+		{
+			visitNode(*child);
+		}
+	};
+
+	visitNode(*ast.root);
+
+	ASSERT_TRUE(escaped != nullptr);
+
+	constexpr size_t threadCount = 8;
+	std::vector<std::string_view> views(threadCount);
+	std::vector<std::thread> threads;
+
+	threads.reserve(threadCount);
+
+	for (size_t i = 0; i < threadCount; ++i)
+	{
+		threads.emplace_back([escaped, &views, i]() {
+			views[i] = escaped->unescaped_view();
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (const auto& view : views)
+	{
+		EXPECT_EQ("a\xC3\xA9\xF0\x9F\x98\x80\t\"b", view);
+		EXPECT_EQ(views.front().data(), view.data()) << "every thread should share the cached value";
+	}
+}
+
+TEST(PegtlCase, ParseLimits)
+{
+	std::string nestedSelections;
+	std::string nestedLists = "{ field(arg: ";
+
+	for (size_t i = 0; i < 10; ++i)
+	{
+		nestedSelections += "{ field ";
+	}
+
+	for (size_t i = 0; i < 9; ++i)
+	{
+		nestedLists += '[';
+	}
+
+	nestedSelections += std::string(10, '}');
+	nestedLists += std::string(9, ']') + ") }";
+
+	parse_limits limits;
+
+	limits.maxDepth = 10;
+	EXPECT_TRUE(parseString(nestedSelections, limits).root != nullptr);
+	EXPECT_TRUE(parseString(nestedLists, limits).root != nullptr)
+		<< "the selection set and the list values should both count towards the depth";
+
+	limits.maxDepth = 9;
+	EXPECT_THROW(parseString(nestedSelections, limits), parse_error);
+	EXPECT_THROW(parseString(nestedLists, limits), parse_error);
+
+	limits = {};
+	limits.maxNodes = 20;
+	EXPECT_TRUE(parseString("{ a b c }", limits).root != nullptr);
+	EXPECT_THROW(parseString("{ a b c d e f g h i j k l m n o p q r s t }", limits), parse_error);
+
+	limits = {};
+	limits.maxBytes = 9;
+	EXPECT_TRUE(parseString("{ a b c }", limits).root != nullptr);
+	EXPECT_THROW(parseString("{ a b c d }", limits), parse_error);
+	EXPECT_THROW(parseString(std::string { "{ a b c d }" }, limits), parse_error);
+}
+
 TEST(PegtlCase, AnalyzeMixedGrammar)
 {
 	ASSERT_EQ(0, analyze<mixed_document>(true))
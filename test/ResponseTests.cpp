@@ -4,9 +4,160 @@
 #include <gtest/gtest.h>
 
 #include "graphqlservice/GraphQLResponse.h"
+#include "graphqlservice/JSONResponse.h"
+
+#ifdef GRAPHQL_BUILD_CBOR
+#include "graphqlservice/CBORResponse.h"
+#endif // GRAPHQL_BUILD_CBOR
+
+#ifdef GRAPHQL_BUILD_MESSAGEPACK
+#include "graphqlservice/MessagePackResponse.h"
+#endif // GRAPHQL_BUILD_MESSAGEPACK
+
+#include <limits>
 
 using namespace graphql;
 
+// Build a response with every response::Type, including a Scalar which wraps an EnumValue and a
+// Map with a List, and long enough strings, lists, and ints to need the larger encodings.
+response::Value makeEveryType()
+{
+	response::Value enumValue(response::Type::EnumValue);
+
+	enumValue.set<response::StringType>("ENUM_VALUE");
+
+	response::Value scalarMap(response::Type::Map);
+	response::Value scalarList(response::Type::List);
+
+	scalarList.emplace_back(std::move(enumValue));
+	scalarList.emplace_back(response::Value(-12345));
+	scalarMap.emplace_back("list", std::move(scalarList));
+
+	response::Value scalar(response::Type::Scalar);
+
+	scalar.set<response::ScalarType>(std::move(scalarMap));
+
+	response::Value ints(response::Type::List);
+
+	for (const auto value : { 0, 1, 23, 24, 127, 128, 255, 256, 65535, 65536, -1, -24, -25, -32,
+			 -33, -128, -129, -32768, -32769, std::numeric_limits<response::IntType>::max(),
+			 std::numeric_limits<response::IntType>::min() })
+	{
+		ints.emplace_back(response::Value(value));
+	}
+
+	response::Value longList(response::Type::List);
+
+	for (int i = 0; i < 300; ++i)
+	{
+		longList.emplace_back(response::Value(i % 2 == 0));
+	}
+
+	response::Value data(response::Type::Map);
+
+	data.emplace_back("string", response::Value("Test \"quoted\" String"));
+	data.emplace_back("longString", response::Value(std::string(70000, 'x')));
+	data.emplace_back("null", response::Value());
+	data.emplace_back("boolean", response::Value(true));
+	data.emplace_back("float", response::Value(-2.5));
+	data.emplace_back("ints", std::move(ints));
+	data.emplace_back("longList", std::move(longList));
+	data.emplace_back("emptyList", response::Value(response::Type::List));
+	data.emplace_back("emptyMap", response::Value(response::Type::Map));
+	data.emplace_back("scalar", std::move(scalar));
+
+	response::Value response(response::Type::Map);
+
+	response.emplace_back("data", std::move(data));
+
+	return response;
+}
+
+#ifdef GRAPHQL_BUILD_CBOR
+TEST(ResponseCase, CBORRoundTrip)
+{
+	const auto expected = makeEveryType();
+	const auto cbor = response::toCBOR(response::Value(expected));
+	const auto actual = response::parseCBOR(cbor);
+
+	EXPECT_TRUE(expected == actual) << "every type should round trip through CBOR";
+
+	const auto& scalar = actual["data"]["scalar"];
+
+	ASSERT_TRUE(response::Type::Scalar == scalar.type());
+	EXPECT_TRUE(response::Type::EnumValue
+		== scalar.get<response::ScalarType>()["list"][0].type());
+}
+
+TEST(ResponseCase, CBORIsSmallerThanJSON)
+{
+	constexpr auto json = R"js({"data":{"appointments":{"edges":[{"node":{)js"
+						  R"js("id":"ZmFrZUFwcG9pbnRtZW50SWQ=","when":"tomorrow","subject":"Lunch?",)js"
+						  R"js("isNow":false,"priority":-100000}}]}}})js";
+	const auto cbor = response::toCBOR(response::parseJSON(json));
+
+	EXPECT_GT(std::string_view { json }.size(), cbor.size());
+	EXPECT_EQ(response::toJSON(response::parseJSON(json)),
+		response::toJSON(response::parseCBOR(cbor)));
+}
+
+TEST(ResponseCase, ParseInvalidCBOR)
+{
+	// Truncated text string
+	EXPECT_THROW(response::parseCBOR({ 0x63, 'a', 'b' }), std::runtime_error);
+	// Byte string
+	EXPECT_THROW(response::parseCBOR({ 0x41, 0x00 }), std::runtime_error);
+	// Trailing data
+	EXPECT_THROW(response::parseCBOR({ 0xF6, 0xF6 }), std::runtime_error);
+	// 2^32 doesn't fit in an Int
+	EXPECT_THROW(response::parseCBOR({ 0x1B, 0, 0, 0, 1, 0, 0, 0, 0 }), std::overflow_error);
+	// Indefinite length map with a half precision float
+	EXPECT_TRUE(response::parseCBOR({ 0xBF, 0x61, 'a', 0xF9, 0x3E, 0x00, 0xFF })["a"]
+		== response::Value(1.5));
+}
+#endif // GRAPHQL_BUILD_CBOR
+
+#ifdef GRAPHQL_BUILD_MESSAGEPACK
+TEST(ResponseCase, MessagePackRoundTrip)
+{
+	const auto expected = makeEveryType();
+	const auto msgpack = response::toMessagePack(response::Value(expected));
+	const auto actual = response::parseMessagePack(msgpack);
+
+	EXPECT_TRUE(expected == actual) << "every type should round trip through MessagePack";
+
+	const auto& scalar = actual["data"]["scalar"];
+
+	ASSERT_TRUE(response::Type::Scalar == scalar.type());
+	EXPECT_TRUE(response::Type::EnumValue
+		== scalar.get<response::ScalarType>()["list"][0].type());
+}
+
+TEST(ResponseCase, MessagePackIsSmallerThanJSON)
+{
+	constexpr auto json = R"js({"data":{"appointments":{"edges":[{"node":{)js"
+						  R"js("id":"ZmFrZUFwcG9pbnRtZW50SWQ=","when":"tomorrow","subject":"Lunch?",)js"
+						  R"js("isNow":false,"priority":-100000}}]}}})js";
+	const auto msgpack = response::toMessagePack(response::parseJSON(json));
+
+	EXPECT_GT(std::string_view { json }.size(), msgpack.size());
+	EXPECT_EQ(response::toJSON(response::parseJSON(json)),
+		response::toJSON(response::parseMessagePack(msgpack)));
+}
+
+TEST(ResponseCase, ParseInvalidMessagePack)
+{
+	// Truncated array
+	EXPECT_THROW(response::parseMessagePack({ 0x92, 0xC0 }), std::runtime_error);
+	// bin 8
+	EXPECT_THROW(response::parseMessagePack({ 0xC4, 0x00 }), std::runtime_error);
+	// Unknown extension type
+	EXPECT_THROW(response::parseMessagePack({ 0xD4, 0x7F, 0x00 }), std::runtime_error);
+	// uint 32 doesn't fit in an Int
+	EXPECT_THROW(response::parseMessagePack({ 0xCE, 0x80, 0, 0, 0 }), std::overflow_error);
+}
+#endif // GRAPHQL_BUILD_MESSAGEPACK
+
 TEST(ResponseCase, ValueConstructorFromStringLiteral)
 {
 	auto expected = "Test String";
@@ -15,3 +166,39 @@ TEST(ResponseCase, ValueConstructorFromStringLiteral)
 	ASSERT_TRUE(response::Type::String == actual.type());
 	ASSERT_EQ(expected, actual.release<response::StringType>());
 }
+
+TEST(ResponseCase, WriteJSONInChunks)
+{
+	constexpr auto json =
+		R"js({"data":{"list":[1,2.5,true,null],"string":"Test \"quoted\" String"}})js";
+	std::vector<std::string> chunks;
+	response::JSONCallbackSink sink { [&chunks](std::string_view chunk) {
+		chunks.emplace_back(chunk);
+	} };
+
+	response::writeJSON(response::parseJSON(json), sink, 8);
+
+	ASSERT_FALSE(chunks.empty());
+
+	std::string actual;
+
+	for (const auto& chunk : chunks)
+	{
+		EXPECT_GE(size_t { 8 }, chunk.size()) << "each chunk should fit in the chunk size";
+		actual.append(chunk);
+	}
+
+	EXPECT_EQ(response::toJSON(response::parseJSON(json)), actual);
+}
+
+TEST(ResponseCase, WriteEscapedKeysAndStrings)
+{
+	response::Value response(response::Type::Map);
+
+	response.emplace_back("plain_Name1", response::Value(1));
+	response.emplace_back("needs \"escaping\"\n", response::Value(std::string { "a\0b", 3 }));
+
+	EXPECT_EQ(R"js({"plain_Name1":1,"needs \"escaping\"\n":"a\u0000b"})js",
+		response::toJSON(std::move(response)))
+		<< "only keys which are not GraphQL names should be escaped";
+}
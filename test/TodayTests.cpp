@@ -5,9 +5,14 @@
 
 #include "TodayMock.h"
 
+#include "graphqlservice/DataLoader.h"
+#include "graphqlservice/GraphQLGrammar.h"
+#include "graphqlservice/GraphQLTree.h"
 #include "graphqlservice/JSONResponse.h"
+#include "graphqlservice/PersistedQueries.h"
 
 #include <chrono>
+#include <thread>
 
 using namespace graphql;
 
@@ -428,6 +433,167 @@ TEST_F(TodayServiceCase, QueryAppointmentsWithForceErrorAsync)
 	}
 }
 
+TEST_F(TodayServiceCase, QueryAppointmentsWithForceErrorThreadPool)
+{
+	auto query = R"({
+			appointments {
+				edges {
+					node {
+						appointmentId: id
+						forceError
+					}
+				}
+			}
+		})"_graphql;
+	auto executor = std::make_shared<service::ThreadPoolExecutor>(2);
+	auto result = _service
+					  ->resolve(executor,
+						  std::make_shared<today::RequestState>(21),
+						  query,
+						  "",
+						  response::Value(response::Type::Map))
+					  .get();
+
+	ASSERT_TRUE(result.type() == response::Type::Map);
+	auto errorsItr = result.find("errors");
+	ASSERT_FALSE(errorsItr == result.get<response::MapType>().cend()) << "should return an error";
+	EXPECT_EQ(
+		R"js([{"message":"Field error name: forceError unknown error: this error was forced","locations":[{"line":6,"column":7}],"path":["appointments","edges",0,"node","forceError"]}])js",
+		response::toJSON(response::Value(errorsItr->second)))
+		<< "the generated resolvers should pass along the full error path";
+}
+
+TEST_F(TodayServiceCase, WriteAppointmentsWithForceError)
+{
+	auto query = R"({
+			appointments {
+				edges {
+					node {
+						appointmentId: id
+						subject
+						when
+						isNow
+						forceError
+					}
+				}
+			}
+			tasks {
+				edges {
+					node {
+						id
+						title
+						isComplete
+					}
+				}
+			}
+		})"_graphql;
+	auto result = _service
+					  ->resolve(std::make_shared<today::RequestState>(3),
+						  query,
+						  "",
+						  response::Value(response::Type::Map))
+					  .get();
+	const auto expected = response::toJSON(std::move(result));
+	std::string written;
+	response::JSONCallbackSink sink { [&written](std::string_view chunk) {
+		written.append(chunk);
+	} };
+	response::JSONWriter writer { sink, 16 };
+
+	_service
+		->resolve(std::launch::async,
+			std::make_shared<today::RequestState>(4),
+			query,
+			"",
+			response::Value(response::Type::Map),
+			writer)
+		.get();
+
+	EXPECT_EQ(expected, written) << "written document should match the resolved value";
+
+	written.clear();
+	_service
+		->resolve(std::launch::deferred,
+			std::make_shared<today::RequestState>(5),
+			query,
+			"MissingOperation",
+			response::Value(response::Type::Map),
+			writer)
+		.get();
+
+	EXPECT_EQ(
+		R"js({"data":null,"errors":[{"message":"Missing operation name: MissingOperation"}]})js",
+		written)
+		<< "missing operation should be written with an error";
+}
+
+TEST_F(TodayServiceCase, DeferAndStream)
+{
+	auto query = R"({
+			appointments {
+				edges @stream(label: "edges") {
+					node {
+						subject
+					}
+				}
+			}
+			... @defer(label: "tasks") {
+				tasks {
+					edges {
+						node {
+							title
+						}
+					}
+				}
+			}
+			unreadCounts {
+				edges @stream(initialCount: 1) {
+					node {
+						name
+					}
+				}
+			}
+		})"_graphql;
+	std::vector<std::string> payloads;
+
+	_service
+		->resolve(std::launch::deferred,
+			std::make_shared<today::RequestState>(6),
+			query,
+			"",
+			response::Value(response::Type::Map),
+			[&payloads](response::Value&& payload) {
+				payloads.push_back(response::toJSON(std::move(payload)));
+			})
+		.get();
+
+	ASSERT_EQ(size_t(3), payloads.size()) << "should deliver the initial result and 2 payloads";
+	EXPECT_EQ(
+		R"js({"data":{"appointments":{"edges":[]},"unreadCounts":{"edges":[{"node":{"name":"\"Fake\" Inbox"}}]}},"hasNext":true})js",
+		payloads[0])
+		<< "initial result should not include the deferred fragment or streamed elements";
+	EXPECT_EQ(
+		R"js({"data":{"tasks":{"edges":[{"node":{"title":"Don't forget"}}]}},"path":[],"label":"tasks","hasNext":true})js",
+		payloads[1])
+		<< "deferred fragment should be delivered after the initial result";
+	EXPECT_EQ(
+		R"js({"items":[{"node":{"subject":"Lunch?"}}],"path":["appointments","edges",0],"label":"edges","hasNext":false})js",
+		payloads[2])
+		<< "streamed element should be delivered last";
+
+	auto result = _service
+					  ->resolve(std::make_shared<today::RequestState>(7),
+						  query,
+						  "",
+						  response::Value(response::Type::Map))
+					  .get();
+
+	EXPECT_EQ(
+		R"js({"data":{"appointments":{"edges":[{"node":{"subject":"Lunch?"}}]},"tasks":{"edges":[{"node":{"title":"Don't forget"}}]},"unreadCounts":{"edges":[{"node":{"name":"\"Fake\" Inbox"}}]}}})js",
+		response::toJSON(std::move(result)))
+		<< "@defer and @stream should be ignored without an IncrementalCallback";
+}
+
 TEST_F(TodayServiceCase, QueryTasks)
 {
 	auto query = R"gql({
@@ -1151,6 +1317,47 @@ TEST_F(TodayServiceCase, QueryAppointmentsById)
 	}
 }
 
+TEST_F(TodayServiceCase, QueryAppointmentsByDefaultId)
+{
+	auto query = R"(query {
+			appointmentsById {
+				appointmentId: id
+			}
+		})"_graphql;
+
+	// The default arguments are shared across calls, so make sure they are still intact the second
+	// time around.
+	for (size_t i = 0; i < 2; ++i)
+	{
+		auto state = std::make_shared<today::RequestState>(13 + i);
+		auto result =
+			_service->resolve(state, query, "", response::Value(response::Type::Map)).get();
+
+		try
+		{
+			ASSERT_TRUE(result.type() == response::Type::Map);
+			auto errorsItr = result.find("errors");
+			if (errorsItr != result.get<response::MapType>().cend())
+			{
+				FAIL() << response::toJSON(response::Value(errorsItr->second));
+			}
+			const auto data = service::ScalarArgument::require("data", result);
+
+			const auto appointmentsById =
+				service::ScalarArgument::require<service::TypeModifier::List>("appointmentsById",
+					data);
+			ASSERT_EQ(size_t(1), appointmentsById.size());
+			EXPECT_EQ(_fakeAppointmentId,
+				service::IdArgument::require("appointmentId", appointmentsById.front()))
+				<< "id should match the default argument";
+		}
+		catch (service::schema_exception& ex)
+		{
+			FAIL() << response::toJSON(ex.getErrors());
+		}
+	}
+}
+
 TEST_F(TodayServiceCase, UnimplementedFieldError)
 {
 	auto query = R"(query {
@@ -1591,28 +1798,51 @@ TEST_F(TodayServiceCase, NonBlockingQueryAppointmentsById)
 	}
 }
 
-TEST_F(TodayServiceCase, NonExistentTypeIntrospection)
+TEST_F(TodayServiceCase, ThreadPoolQueryAppointmentsById)
 {
-	auto query = R"(query {
-			__type(name: "NonExistentType") {
-				description
+	auto query = R"(query SpecificAppointment($appointmentId: ID!) {
+			appointmentsById(ids: [$appointmentId]) {
+				appointmentId: id
+				subject
+				when
+				isNow
 			}
 		})"_graphql;
 	response::Value variables(response::Type::Map);
-	auto future =
-		_service->resolve(std::launch::deferred, nullptr, query, "", std::move(variables));
+	variables.emplace_back("appointmentId",
+		response::Value(std::string("ZmFrZUFwcG9pbnRtZW50SWQ=")));
+	auto state = std::make_shared<today::RequestState>(17);
+	auto executor = std::make_shared<service::ThreadPoolExecutor>(2);
+	auto future = _service->resolve(executor, state, query, "", std::move(variables));
+	ASSERT_NE(std::future_status::deferred, future.wait_for(0s)) << "should not start out deferred";
 	auto result = future.get();
+	EXPECT_EQ(size_t(17), state->appointmentsRequestId)
+		<< "today service passed the same RequestState";
+	EXPECT_EQ(size_t(1), state->loadAppointmentsCount) << "today service called the loader once";
 
 	try
 	{
 		ASSERT_TRUE(result.type() == response::Type::Map);
 		auto errorsItr = result.find("errors");
-		ASSERT_FALSE(errorsItr == result.get<response::MapType>().cend());
-		auto errorsString = response::toJSON(response::Value(errorsItr->second));
-		EXPECT_EQ(
-			R"js([{"message":"Type not found name: NonExistentType","locations":[{"line":2,"column":4}],"path":["__type"]}])js",
-			errorsString)
-			<< "error should match";
+		if (errorsItr != result.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		const auto data = service::ScalarArgument::require("data", result);
+
+		const auto appointmentsById =
+			service::ScalarArgument::require<service::TypeModifier::List>("appointmentsById", data);
+		ASSERT_EQ(size_t(1), appointmentsById.size());
+		const auto& appointmentEntry = appointmentsById.front();
+		EXPECT_EQ(_fakeAppointmentId,
+			service::IdArgument::require("appointmentId", appointmentEntry))
+			<< "id should match in base64 encoding";
+		EXPECT_EQ("Lunch?", service::StringArgument::require("subject", appointmentEntry))
+			<< "subject should match";
+		EXPECT_EQ("tomorrow", service::StringArgument::require("when", appointmentEntry))
+			<< "when should match";
+		EXPECT_FALSE(service::BooleanArgument::require("isNow", appointmentEntry))
+			<< "isNow should match";
 	}
 	catch (service::schema_exception& ex)
 	{
@@ -1620,28 +1850,32 @@ TEST_F(TodayServiceCase, NonExistentTypeIntrospection)
 	}
 }
 
-TEST_F(TodayServiceCase, SubscribeNextAppointmentChangeAsync)
+TEST_F(TodayServiceCase, CachedExecutionPlan)
 {
-	auto query = peg::parseString(R"(subscription TestSubscription {
-			nextAppointment: nextAppointmentChange {
-				nextAppointmentId: id
-				when
-				subject
-				isNow
+	auto query = R"(query SpecificAppointment($appointmentId: ID!, $withSubject: Boolean!) {
+			appointmentsById(ids: [$appointmentId]) {
+				appointmentId: id
+				subject @include(if: $withSubject)
+				when @skip(if: true)
 			}
-		})");
+		})"_graphql;
 	response::Value variables(response::Type::Map);
-	auto state = std::make_shared<today::RequestState>(17);
-	response::Value result;
-	auto key = _service->subscribe(service::SubscriptionParams { state,
-									   std::move(query),
-									   "TestSubscription",
-									   std::move(std::move(variables)) },
-		[&result](std::future<response::Value> response) {
-			result = response.get();
-		});
-	_service->deliver(std::launch::async, "nextAppointmentChange", nullptr);
-	_service->unsubscribe(key);
+	variables.emplace_back("appointmentId",
+		response::Value(std::string("ZmFrZUFwcG9pbnRtZW50SWQ=")));
+	variables.emplace_back("withSubject", response::Value(true));
+	auto state = std::make_shared<today::RequestState>(18);
+	auto result = _service->resolve(state, query, "", std::move(variables)).get();
+	const auto plan = query.plan;
+
+	ASSERT_TRUE(plan) << "should cache the plan on the query";
+
+	variables = response::Value(response::Type::Map);
+	variables.emplace_back("appointmentId",
+		response::Value(std::string("ZmFrZUFwcG9pbnRtZW50SWQ=")));
+	variables.emplace_back("withSubject", response::Value(false));
+	auto cachedResult = _service->resolve(state, query, "", std::move(variables)).get();
+
+	EXPECT_EQ(plan, query.plan) << "should reuse the cached plan";
 
 	try
 	{
@@ -1652,17 +1886,37 @@ TEST_F(TodayServiceCase, SubscribeNextAppointmentChangeAsync)
 			FAIL() << response::toJSON(response::Value(errorsItr->second));
 		}
 		const auto data = service::ScalarArgument::require("data", result);
-
-		const auto appointmentNode = service::ScalarArgument::require("nextAppointment", data);
+		const auto appointmentsById =
+			service::ScalarArgument::require<service::TypeModifier::List>("appointmentsById", data);
+		ASSERT_EQ(size_t(1), appointmentsById.size());
+		const auto& appointmentEntry = appointmentsById.front();
 		EXPECT_EQ(_fakeAppointmentId,
-			service::IdArgument::require("nextAppointmentId", appointmentNode))
+			service::IdArgument::require("appointmentId", appointmentEntry))
 			<< "id should match in base64 encoding";
-		EXPECT_EQ("Lunch?", service::StringArgument::require("subject", appointmentNode))
+		EXPECT_EQ("Lunch?", service::StringArgument::require("subject", appointmentEntry))
 			<< "subject should match";
-		EXPECT_EQ("tomorrow", service::StringArgument::require("when", appointmentNode))
-			<< "when should match";
-		EXPECT_TRUE(service::BooleanArgument::require("isNow", appointmentNode))
-			<< "isNow should match";
+		EXPECT_TRUE(appointmentEntry.find("when") == appointmentEntry.end())
+			<< "when should be skipped";
+
+		ASSERT_TRUE(cachedResult.type() == response::Type::Map);
+		errorsItr = cachedResult.find("errors");
+		if (errorsItr != cachedResult.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		const auto cachedData = service::ScalarArgument::require("data", cachedResult);
+		const auto cachedAppointmentsById =
+			service::ScalarArgument::require<service::TypeModifier::List>("appointmentsById",
+				cachedData);
+		ASSERT_EQ(size_t(1), cachedAppointmentsById.size());
+		const auto& cachedAppointmentEntry = cachedAppointmentsById.front();
+		EXPECT_EQ(_fakeAppointmentId,
+			service::IdArgument::require("appointmentId", cachedAppointmentEntry))
+			<< "id should match in base64 encoding";
+		EXPECT_TRUE(cachedAppointmentEntry.find("subject") == cachedAppointmentEntry.end())
+			<< "subject should not be included";
+		EXPECT_TRUE(cachedAppointmentEntry.find("when") == cachedAppointmentEntry.end())
+			<< "when should be skipped";
 	}
 	catch (service::schema_exception& ex)
 	{
@@ -1670,69 +1924,78 @@ TEST_F(TodayServiceCase, SubscribeNextAppointmentChangeAsync)
 	}
 }
 
-TEST_F(TodayServiceCase, NonblockingDeferredExpensive)
+TEST_F(TodayServiceCase, ResolveValidatedQueryConcurrently)
 {
-	auto query = R"(query NonblockingDeferredExpensive {
-			expensive {
-				order
+	auto query = R"(query {
+			appointmentsById(ids: ["ZmFrZUFwcG9pbnRtZW50SWQ="]) {
+				subject
 			}
 		})"_graphql;
-	response::Value variables(response::Type::Map);
-	auto state = std::make_shared<today::RequestState>(18);
-	std::unique_lock testLock(today::Expensive::testMutex);
-	auto future = _service->resolve(std::launch::deferred,
-		state,
-		query,
-		"NonblockingDeferredExpensive",
-		std::move(variables));
-	auto result = future.get();
 
-	try
+	ASSERT_TRUE(_service->validate(query).empty()) << "should pass validation";
+
+	const auto plan = query.plan;
+
+	ASSERT_TRUE(plan) << "should compile the plan when the query is validated";
+
+	constexpr size_t c_threadCount = 4;
+	std::vector<std::future<response::Value>> results;
+
+	results.reserve(c_threadCount);
+
+	for (size_t i = 0; i < c_threadCount; ++i)
 	{
-		ASSERT_TRUE(today::Expensive::Reset()) << "there should be no remaining instances";
-		ASSERT_TRUE(result.type() == response::Type::Map);
-		auto errorsItr = result.find("errors");
-		ASSERT_TRUE(errorsItr == result.get<response::MapType>().cend());
-		auto response = response::toJSON(response::Value(result));
-		EXPECT_EQ(
-			R"js({"data":{"expensive":[{"order":1},{"order":2},{"order":3},{"order":4},{"order":5}]}})js",
-			response)
-			<< "output should match";
+		results.push_back(std::async(std::launch::async, [this, &query, i]() {
+			auto state = std::make_shared<today::RequestState>(19 + i);
+
+			return _service->resolve(state, query, "", response::Value(response::Type::Map))
+				.get();
+		}));
 	}
-	catch (service::schema_exception& ex)
+
+	for (auto& future : results)
 	{
-		FAIL() << response::toJSON(ex.getErrors());
+		const auto result = future.get();
+		const auto data = service::ScalarArgument::require("data", result);
+		const auto appointmentsById =
+			service::ScalarArgument::require<service::TypeModifier::List>("appointmentsById", data);
+
+		ASSERT_EQ(size_t(1), appointmentsById.size());
+		EXPECT_EQ("Lunch?", service::StringArgument::require("subject", appointmentsById.front()))
+			<< "subject should match";
 	}
+
+	EXPECT_EQ(plan, query.plan) << "should not replace the plan while resolving";
 }
 
-TEST_F(TodayServiceCase, BlockingAsyncExpensive)
+TEST_F(TodayServiceCase, ResolveMarkedValidatedQuery)
 {
-	auto query = R"(query BlockingAsyncExpensive {
-			expensive {
-				order
+	auto query = R"(query {
+			appointmentsById(ids: ["ZmFrZUFwcG9pbnRtZW50SWQ="]) {
+				subject
 			}
 		})"_graphql;
-	response::Value variables(response::Type::Map);
-	auto state = std::make_shared<today::RequestState>(19);
-	std::unique_lock testLock(today::Expensive::testMutex);
-	auto future = _service->resolve(std::launch::async,
-		state,
-		query,
-		"BlockingAsyncExpensive",
-		std::move(variables));
-	auto result = future.get();
+
+	// Skip Request::validate, so the query doesn't have a compiled plan yet.
+	query.validated = true;
+
+	ASSERT_FALSE(query.plan) << "should not have a plan before resolving";
+
+	const auto result =
+		_service->resolve(nullptr, query, "", response::Value(response::Type::Map)).get();
+
+	EXPECT_TRUE(query.plan) << "should compile the missing plan";
 
 	try
 	{
-		ASSERT_TRUE(today::Expensive::Reset()) << "there should be no remaining instances";
 		ASSERT_TRUE(result.type() == response::Type::Map);
-		auto errorsItr = result.find("errors");
-		ASSERT_TRUE(errorsItr == result.get<response::MapType>().cend());
-		auto response = response::toJSON(response::Value(result));
-		EXPECT_EQ(
-			R"js({"data":{"expensive":[{"order":1},{"order":2},{"order":3},{"order":4},{"order":5}]}})js",
-			response)
-			<< "output should match";
+		const auto data = service::ScalarArgument::require("data", result);
+		const auto appointmentsById =
+			service::ScalarArgument::require<service::TypeModifier::List>("appointmentsById", data);
+
+		ASSERT_EQ(size_t(1), appointmentsById.size());
+		EXPECT_EQ("Lunch?", service::StringArgument::require("subject", appointmentsById.front()))
+			<< "subject should match";
 	}
 	catch (service::schema_exception& ex)
 	{
@@ -1740,20 +2003,588 @@ TEST_F(TodayServiceCase, BlockingAsyncExpensive)
 	}
 }
 
-TEST_F(TodayServiceCase, QueryAppointmentsThroughUnionTypeFragment)
+TEST_F(TodayServiceCase, PersistedQueryHash)
 {
-	auto query = R"({
-			appointments {
-				edges {
-					node {
-						...AppointmentUnionFragment
-					}
-				}
-			}
-		}
+	EXPECT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+		service::hashQuery(""))
+		<< "should match the SHA-256 test vector";
+	EXPECT_EQ("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+		service::hashQuery("abc"))
+		<< "should match the SHA-256 test vector";
+	EXPECT_EQ("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1",
+		service::hashQuery("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"))
+		<< "should match the SHA-256 test vector";
+}
 
-		fragment AppointmentUnionFragment on UnionType {
-			...on Appointment {
+TEST_F(TodayServiceCase, PersistedQueryResolve)
+{
+	service::PersistedQueries persistedQueries { _service };
+	const auto id = persistedQueries.add(R"(query($appointmentId: ID!) {
+			appointmentsById(ids: [$appointmentId]) {
+				appointmentId: id
+				subject
+			}
+		})");
+	const auto query = persistedQueries.find(id);
+
+	ASSERT_TRUE(query) << "should find the query by ID";
+	EXPECT_TRUE(query->validated) << "should validate the query when it's added";
+	EXPECT_TRUE(query->plan) << "should compile the plan when it's added";
+
+	response::Value variables(response::Type::Map);
+	variables.emplace_back("appointmentId",
+		response::Value(std::string("ZmFrZUFwcG9pbnRtZW50SWQ=")));
+	auto state = std::make_shared<today::RequestState>(19);
+	auto result = persistedQueries.resolve(state, id, "", std::move(variables)).get();
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		if (errorsItr != result.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		const auto data = service::ScalarArgument::require("data", result);
+		const auto appointmentsById =
+			service::ScalarArgument::require<service::TypeModifier::List>("appointmentsById", data);
+		ASSERT_EQ(size_t(1), appointmentsById.size());
+		const auto& appointmentEntry = appointmentsById.front();
+		EXPECT_EQ(_fakeAppointmentId,
+			service::IdArgument::require("appointmentId", appointmentEntry))
+			<< "id should match in base64 encoding";
+		EXPECT_EQ("Lunch?", service::StringArgument::require("subject", appointmentEntry))
+			<< "subject should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+
+	result = persistedQueries
+				 .resolve(state, "missing", "", response::Value(response::Type::Map))
+				 .get();
+
+	ASSERT_TRUE(result.type() == response::Type::Map);
+	const auto errors = service::ScalarArgument::require<service::TypeModifier::List>(
+		"errors",
+		result);
+	ASSERT_EQ(size_t(1), errors.size());
+	EXPECT_EQ("PersistedQueryNotFound", service::StringArgument::require("message", errors.front()))
+		<< "should report that the ID is not in the cache";
+}
+
+TEST_F(TodayServiceCase, PersistedQueryEviction)
+{
+	service::PersistedQueries persistedQueries { _service, 2 };
+
+	persistedQueries.addUnchecked("first", "{ appointments { edges { node { id } } } }");
+	persistedQueries.addUnchecked("second", "{ tasks { edges { node { id } } } }");
+
+	ASSERT_TRUE(persistedQueries.find("first")) << "should find the first query";
+
+	persistedQueries.addUnchecked("third", "{ unreadCounts { edges { node { id } } } }");
+
+	EXPECT_EQ(size_t(2), persistedQueries.size()) << "should be bounded by the capacity";
+	EXPECT_TRUE(persistedQueries.find("first")) << "first query was recently used";
+	EXPECT_FALSE(persistedQueries.find("second")) << "second query should be evicted";
+	EXPECT_TRUE(persistedQueries.find("third")) << "third query was just added";
+	EXPECT_THROW(persistedQueries.addUnchecked("invalid", "{ nonExistentField }"), service::schema_exception)
+		<< "should not store queries which fail validation";
+	EXPECT_FALSE(persistedQueries.find("invalid")) << "should not store the invalid query";
+}
+
+TEST_F(TodayServiceCase, PersistedQueryHashMismatch)
+{
+	service::PersistedQueries persistedQueries { _service };
+	constexpr auto queryText = "{ appointments { edges { node { id } } } }";
+
+	EXPECT_THROW(persistedQueries.add(service::hashQuery("{ tasks { edges { node { id } } } }"),
+					 queryText),
+		service::schema_exception)
+		<< "should check the ID against the query";
+	EXPECT_EQ(size_t(0), persistedQueries.size()) << "should not store the mismatched query";
+
+	persistedQueries.add(service::hashQuery(queryText), queryText);
+
+	EXPECT_TRUE(persistedQueries.find(service::hashQuery(queryText)))
+		<< "should store the query with a matching ID";
+}
+
+TEST_F(TodayServiceCase, PersistedQueryClearedWhileResolving)
+{
+	service::PersistedQueries persistedQueries { _service };
+	constexpr auto queryText = R"(query {
+			appointmentsById(ids: ["ZmFrZUFwcG9pbnRtZW50SWQ="]) {
+				subject
+			}
+		})";
+	const auto id = persistedQueries.add(queryText);
+	std::weak_ptr<peg::ast_node> root = persistedQueries.find(id)->root;
+	auto executor = std::make_shared<service::ThreadPoolExecutor>(1);
+	auto result = persistedQueries.resolve(executor,
+		nullptr,
+		id,
+		"",
+		response::Value(response::Type::Map));
+
+	// The posted operation is the only owner of the AST once the query is cleared from the cache.
+	persistedQueries.clear();
+
+	const auto document = result.get();
+	const auto data = service::ScalarArgument::require("data", document);
+	const auto appointmentsById =
+		service::ScalarArgument::require<service::TypeModifier::List>("appointmentsById", data);
+
+	ASSERT_EQ(size_t(1), appointmentsById.size());
+	EXPECT_EQ("Lunch?", service::StringArgument::require("subject", appointmentsById.front()))
+		<< "subject should match";
+
+	// Drop the future without waiting for it, the operation still owns the AST until it's done.
+	persistedQueries.add(id, queryText);
+	root = persistedQueries.find(id)->root;
+	persistedQueries.resolve(executor, nullptr, id, "", response::Value(response::Type::Map));
+	persistedQueries.clear();
+	executor.reset();
+
+	EXPECT_TRUE(root.expired()) << "should release the AST when the operation is done";
+}
+
+TEST(DataLoaderCase, BatchPendingKeys)
+{
+	std::vector<std::vector<int>> batches;
+	service::DataLoader<int, std::string> loader { [&batches](std::vector<int>&& keys) {
+		std::vector<std::string> values(keys.size());
+
+		std::transform(keys.cbegin(), keys.cend(), values.begin(), [](int key) {
+			return std::to_string(key);
+		});
+		batches.push_back(std::move(keys));
+
+		return values;
+	} };
+
+	auto first = loader.load(1);
+	auto second = loader.load(2);
+	auto many = loader.loadMany({ 2, 3 });
+
+	EXPECT_TRUE(batches.empty()) << "should not load anything until a result is needed";
+	EXPECT_EQ("2", second.get()) << "value should match";
+	ASSERT_EQ(size_t(1), batches.size()) << "should load all of the pending keys at once";
+	EXPECT_EQ((std::vector<int> { 1, 2, 3 }), batches.front()) << "should not repeat keys";
+	EXPECT_EQ("1", first.get()) << "value should match";
+	EXPECT_EQ((std::vector<std::string> { "2", "3" }), many.get()) << "values should match";
+
+	auto cached = loader.load(3);
+
+	EXPECT_EQ("3", cached.get()) << "value should match";
+	EXPECT_EQ(size_t(1), batches.size()) << "should cache the loaded keys";
+
+	loader.clear(3);
+
+	auto reloaded = loader.load(3);
+
+	EXPECT_EQ("3", reloaded.get()) << "value should match";
+	ASSERT_EQ(size_t(2), batches.size()) << "should load the key again after clearing it";
+	EXPECT_EQ((std::vector<int> { 3 }), batches.back()) << "should only load the cleared key";
+}
+
+TEST(DataLoaderCase, ClearPendingKeys)
+{
+	std::vector<std::vector<int>> batches;
+	service::DataLoader<int, std::string> loader { [&batches](std::vector<int>&& keys) {
+		std::vector<std::string> values(keys.size());
+
+		std::transform(keys.cbegin(), keys.cend(), values.begin(), [](int key) {
+			return std::to_string(key);
+		});
+		batches.push_back(std::move(keys));
+
+		return values;
+	} };
+
+	auto first = loader.load(1);
+	auto second = loader.load(2);
+
+	loader.clear(1);
+	loader.clear();
+
+	auto reloaded = loader.load(1);
+
+	EXPECT_EQ("1", reloaded.get()) << "value should match";
+	EXPECT_EQ("1", first.get()) << "value should match";
+	EXPECT_EQ("2", second.get()) << "value should match";
+	ASSERT_EQ(size_t(1), batches.size()) << "should load all of the pending keys at once";
+	EXPECT_EQ((std::vector<int> { 1, 2 }), batches.front()) << "should not repeat pending keys";
+
+	loader.clear();
+
+	auto cleared = loader.load(2);
+
+	EXPECT_EQ("2", cleared.get()) << "value should match";
+	ASSERT_EQ(size_t(2), batches.size()) << "should load the key again after it was loaded";
+	EXPECT_EQ((std::vector<int> { 2 }), batches.back()) << "should only load the cleared key";
+}
+
+TEST(DataLoaderCase, BatchErrors)
+{
+	size_t batchCount = 0;
+	service::DataLoader<int, std::string> loader { [&batchCount](std::vector<int>&&) {
+		++batchCount;
+		throw std::runtime_error("backend error");
+
+		return std::vector<std::string> {};
+	} };
+
+	EXPECT_TRUE(loader.prime(1, "primed")) << "should add the primed value";
+
+	auto primed = loader.load(1);
+	auto first = loader.load(2);
+	auto second = loader.load(3);
+
+	EXPECT_EQ("primed", primed.get()) << "should not load the primed key";
+	EXPECT_THROW(first.get(), std::runtime_error) << "should propagate the batch error";
+	EXPECT_THROW(second.get(), std::runtime_error) << "should propagate the batch error";
+	EXPECT_EQ(size_t(1), batchCount) << "should only call the batch function once";
+
+	auto retried = loader.load(2);
+
+	EXPECT_THROW(retried.get(), std::runtime_error) << "should propagate the batch error";
+	EXPECT_EQ(size_t(2), batchCount) << "should not cache the failed keys";
+}
+
+// RequestState with a DataLoader which records each batch of keys.
+struct BatchedRequestState : service::RequestState
+{
+	BatchedRequestState()
+		: values { *this,
+			[this](std::vector<int>&& keys) {
+				std::vector<std::string> result(keys.size());
+
+				std::transform(keys.cbegin(), keys.cend(), result.begin(), [](int key) {
+					return std::to_string(key);
+				});
+
+				std::lock_guard lock { batchMutex };
+
+				batches.push_back(std::move(keys));
+
+				return result;
+			} }
+	{
+	}
+
+	std::mutex batchMutex;
+	std::vector<std::vector<int>> batches;
+	service::DataLoader<int, std::string> values;
+};
+
+// Object with a single field which loads its value through the DataLoader in the RequestState.
+class BatchedObject : public service::Object
+{
+public:
+	explicit BatchedObject(int key)
+		: service::Object(getTypeNames(), getResolvers())
+		, _key(key)
+	{
+	}
+
+private:
+	static const service::TypeNames& getTypeNames() noexcept
+	{
+		static const service::TypeNames s_typeNames { "Batched" };
+
+		return s_typeNames;
+	}
+
+	static const service::FieldResolverMap& getResolvers() noexcept
+	{
+		static const service::FieldResolverMap s_resolvers {
+			{ "value", service::dispatchField<BatchedObject, &BatchedObject::resolveValue> },
+		};
+
+		return s_resolvers;
+	}
+
+	service::FieldResult<service::ResolverResult> resolveValue(service::ResolverParams&& params)
+	{
+		auto state = std::static_pointer_cast<BatchedRequestState>(params.state);
+
+		return service::ModifiedResult<response::StringType>::convert(state->values.load(_key),
+			std::move(params));
+	}
+
+	const int _key;
+};
+
+TEST(DataLoaderCase, BatchListWithExecutor)
+{
+	auto query = R"({
+			values {
+				value
+			}
+		})"_graphql;
+	const peg::ast_node* field = nullptr;
+	const peg::ast_node* selection = nullptr;
+
+	peg::on_first_child<peg::operation_definition>(*query.root,
+		[&field, &selection](const peg::ast_node& operationDefinition) {
+			peg::on_first_child<peg::selection_set>(operationDefinition,
+				[&field, &selection](const peg::ast_node& operationSelection) {
+					field = operationSelection.children.front().get();
+					peg::on_first_child<peg::selection_set>(*field,
+						[&selection](const peg::ast_node& fieldSelection) {
+							selection = &fieldSelection;
+						});
+				});
+		});
+
+	ASSERT_NE(nullptr, selection) << "should find the selection set";
+
+	auto batchedState = std::make_shared<BatchedRequestState>();
+	const std::shared_ptr<service::RequestState> state = batchedState;
+	auto executor = std::make_shared<service::ThreadPoolExecutor>(4);
+	const response::Value emptyDirectives(response::Type::Map);
+	const response::Value variables(response::Type::Map);
+	const service::FragmentMap fragments;
+	const service::SelectionSetParams selectionSetParams {
+		service::ResolverContext::Query,
+		state,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		std::make_optional(service::field_path { nullptr, service::path_segment { "values"sv } }),
+		std::launch::async,
+		executor,
+	};
+	std::vector<std::shared_ptr<BatchedObject>> objects;
+
+	for (int key = 1; key <= 8; ++key)
+	{
+		objects.push_back(std::make_shared<BatchedObject>(key));
+	}
+
+	auto result = service::ModifiedResult<BatchedObject>::convert<service::TypeModifier::List>(
+		std::move(objects),
+		service::ResolverParams(selectionSetParams,
+			*field,
+			"values",
+			response::Value(response::Type::Map),
+			response::Value(response::Type::Map),
+			selection,
+			fragments,
+			variables));
+	auto document = result.get();
+
+	EXPECT_TRUE(document.errors.empty()) << "should not have any errors";
+	ASSERT_TRUE(document.data.type() == response::Type::List);
+	ASSERT_EQ(size_t(8), document.data.size());
+	EXPECT_EQ("8", service::StringArgument::require("value", document.data[7]))
+		<< "value should match";
+	ASSERT_EQ(size_t(1), batchedState->batches.size())
+		<< "should load every element of the list in one batch";
+	EXPECT_EQ((std::vector<int> { 1, 2, 3, 4, 5, 6, 7, 8 }), batchedState->batches.front())
+		<< "should load the keys in order";
+}
+
+TEST_F(TodayServiceCase, NonExistentTypeIntrospection)
+{
+	auto query = R"(query {
+			__type(name: "NonExistentType") {
+				description
+			}
+		})"_graphql;
+	response::Value variables(response::Type::Map);
+	auto future =
+		_service->resolve(std::launch::deferred, nullptr, query, "", std::move(variables));
+	auto result = future.get();
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		ASSERT_FALSE(errorsItr == result.get<response::MapType>().cend());
+		auto errorsString = response::toJSON(response::Value(errorsItr->second));
+		EXPECT_EQ(
+			R"js([{"message":"Type not found name: NonExistentType","locations":[{"line":2,"column":4}],"path":["__type"]}])js",
+			errorsString)
+			<< "error should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, SubscribeNextAppointmentChangeAsync)
+{
+	auto query = peg::parseString(R"(subscription TestSubscription {
+			nextAppointment: nextAppointmentChange {
+				nextAppointmentId: id
+				when
+				subject
+				isNow
+			}
+		})");
+	response::Value variables(response::Type::Map);
+	auto state = std::make_shared<today::RequestState>(17);
+	response::Value result;
+	auto key = _service->subscribe(service::SubscriptionParams { state,
+									   std::move(query),
+									   "TestSubscription",
+									   std::move(std::move(variables)) },
+		[&result](std::future<response::Value> response) {
+			result = response.get();
+		});
+	_service->deliver(std::launch::async, "nextAppointmentChange", nullptr);
+	_service->unsubscribe(key);
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		if (errorsItr != result.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		const auto data = service::ScalarArgument::require("data", result);
+
+		const auto appointmentNode = service::ScalarArgument::require("nextAppointment", data);
+		EXPECT_EQ(_fakeAppointmentId,
+			service::IdArgument::require("nextAppointmentId", appointmentNode))
+			<< "id should match in base64 encoding";
+		EXPECT_EQ("Lunch?", service::StringArgument::require("subject", appointmentNode))
+			<< "subject should match";
+		EXPECT_EQ("tomorrow", service::StringArgument::require("when", appointmentNode))
+			<< "when should match";
+		EXPECT_TRUE(service::BooleanArgument::require("isNow", appointmentNode))
+			<< "isNow should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, NonblockingDeferredExpensive)
+{
+	auto query = R"(query NonblockingDeferredExpensive {
+			expensive {
+				order
+			}
+		})"_graphql;
+	response::Value variables(response::Type::Map);
+	auto state = std::make_shared<today::RequestState>(18);
+	std::unique_lock testLock(today::Expensive::testMutex);
+	auto future = _service->resolve(std::launch::deferred,
+		state,
+		query,
+		"NonblockingDeferredExpensive",
+		std::move(variables));
+	auto result = future.get();
+
+	try
+	{
+		ASSERT_TRUE(today::Expensive::Reset()) << "there should be no remaining instances";
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		ASSERT_TRUE(errorsItr == result.get<response::MapType>().cend());
+		auto response = response::toJSON(response::Value(result));
+		EXPECT_EQ(
+			R"js({"data":{"expensive":[{"order":1},{"order":2},{"order":3},{"order":4},{"order":5}]}})js",
+			response)
+			<< "output should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, BlockingAsyncExpensive)
+{
+	auto query = R"(query BlockingAsyncExpensive {
+			expensive {
+				order
+			}
+		})"_graphql;
+	response::Value variables(response::Type::Map);
+	auto state = std::make_shared<today::RequestState>(19);
+	std::unique_lock testLock(today::Expensive::testMutex);
+	auto future = _service->resolve(std::launch::async,
+		state,
+		query,
+		"BlockingAsyncExpensive",
+		std::move(variables));
+	auto result = future.get();
+
+	try
+	{
+		ASSERT_TRUE(today::Expensive::Reset()) << "there should be no remaining instances";
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		ASSERT_TRUE(errorsItr == result.get<response::MapType>().cend());
+		auto response = response::toJSON(response::Value(result));
+		EXPECT_EQ(
+			R"js({"data":{"expensive":[{"order":1},{"order":2},{"order":3},{"order":4},{"order":5}]}})js",
+			response)
+			<< "output should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST_F(TodayServiceCase, StreamAsyncExpensive)
+{
+	auto query = R"(query StreamAsyncExpensive {
+			expensive @stream(initialCount: 1) {
+				order
+			}
+		})"_graphql;
+	auto state = std::make_shared<today::RequestState>(20);
+	std::unique_lock testLock(today::Expensive::testMutex);
+	std::vector<std::string> payloads;
+
+	_service
+		->resolve(std::launch::async,
+			state,
+			query,
+			"StreamAsyncExpensive",
+			response::Value(response::Type::Map),
+			[&payloads](response::Value&& payload) {
+				payloads.push_back(response::toJSON(std::move(payload)));
+			})
+		.get();
+
+	ASSERT_TRUE(today::Expensive::Reset()) << "there should be no remaining instances";
+	ASSERT_EQ(today::Expensive::count, payloads.size())
+		<< "should deliver the initial result and a payload for each of the other elements";
+	EXPECT_EQ(R"js({"data":{"expensive":[{"order":1}]},"hasNext":true})js", payloads.front())
+		<< "initial result should only include the first element";
+	EXPECT_EQ(R"js({"items":[{"order":2}],"path":["expensive",1],"hasNext":true})js", payloads[1])
+		<< "streamed elements should be delivered in order";
+	EXPECT_EQ(R"js({"items":[{"order":5}],"path":["expensive",4],"hasNext":false})js",
+		payloads.back())
+		<< "last streamed element should be delivered last";
+}
+
+TEST_F(TodayServiceCase, QueryAppointmentsThroughUnionTypeFragment)
+{
+	auto query = R"({
+			appointments {
+				edges {
+					node {
+						...AppointmentUnionFragment
+					}
+				}
+			}
+		}
+
+		fragment AppointmentUnionFragment on UnionType {
+			...on Appointment {
 				appointmentId: id
 				subject
 				when
@@ -1973,3 +2804,567 @@ TEST_F(TodayServiceCase, MutateCoerceSetFloat)
 		FAIL() << response::toJSON(ex.getErrors());
 	}
 }
+
+TEST_F(TodayServiceCase, QueryArenaTreeWithoutInput)
+{
+	auto query = peg::parseString(R"(query {
+			appointmentsById(ids: ["ZmFrZUFwcG9pbnRtZW50SWQ\u003d"]) {
+				appointmentId: id
+				subject
+			}
+		})");
+
+	ASSERT_TRUE(query.input) << "parseString should return the input";
+	EXPECT_EQ(&query.input->arena, query.root->children.get_allocator().arena())
+		<< "the nodes should be allocated in the arena owned by the input";
+
+	// The root shares ownership of the input and the arena, so it should still be valid after
+	// releasing every other reference to the input.
+	peg::ast rootOnly { nullptr, query.root };
+
+	query = {};
+
+	auto state = std::make_shared<today::RequestState>(13);
+	auto result = _service->resolve(state, rootOnly, "", response::Value(response::Type::Map)).get();
+
+	try
+	{
+		ASSERT_TRUE(result.type() == response::Type::Map);
+		auto errorsItr = result.find("errors");
+		if (errorsItr != result.get<response::MapType>().cend())
+		{
+			FAIL() << response::toJSON(response::Value(errorsItr->second));
+		}
+		const auto data = service::ScalarArgument::require("data", result);
+
+		const auto appointmentsById =
+			service::ScalarArgument::require<service::TypeModifier::List>("appointmentsById", data);
+		ASSERT_EQ(size_t(1), appointmentsById.size());
+		const auto& appointmentEntry = appointmentsById.front();
+		EXPECT_EQ(_fakeAppointmentId,
+			service::IdArgument::require("appointmentId", appointmentEntry))
+			<< "id should match the unescaped argument";
+		EXPECT_EQ("Lunch?", service::StringArgument::require("subject", appointmentEntry))
+			<< "subject should match";
+	}
+	catch (service::schema_exception& ex)
+	{
+		FAIL() << response::toJSON(ex.getErrors());
+	}
+}
+
+TEST(ResolverResultCase, ConvertReadyFieldResultInline)
+{
+	auto query = R"(query {
+			subject
+		})"_graphql;
+	const auto& field = *query.root;
+	const std::shared_ptr<service::RequestState> state;
+	const response::Value emptyDirectives(response::Type::Map);
+	const response::Value variables(response::Type::Map);
+	const service::FragmentMap fragments;
+	const service::SelectionSetParams selectionSetParams {
+		service::ResolverContext::Query,
+		state,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		std::nullopt,
+	};
+	auto result = service::StringResult::convert<service::TypeModifier::Nullable>(
+		std::make_optional<response::StringType>("Lunch?"),
+		service::ResolverParams(selectionSetParams,
+			field,
+			"subject",
+			response::Value(response::Type::Map),
+			response::Value(response::Type::Map),
+			nullptr,
+			fragments,
+			variables));
+
+	ASSERT_FALSE(result.is_future()) << "should not allocate a future for a ready value";
+
+	auto document = result.get();
+
+	EXPECT_TRUE(document.errors.empty()) << "should not have any errors";
+	ASSERT_TRUE(document.data.type() == response::Type::String);
+	EXPECT_EQ("Lunch?", document.data.get<response::StringType>()) << "should return the subject";
+}
+
+// Object with a single field which fails on another thread after the list containing it has
+// been visited.
+class DelayedErrorObject : public service::Object
+{
+public:
+	explicit DelayedErrorObject(bool fail)
+		: service::Object(getTypeNames(), getResolvers())
+		, _fail(fail)
+	{
+	}
+
+private:
+	static const service::TypeNames& getTypeNames() noexcept
+	{
+		static const service::TypeNames s_typeNames { "DelayedError" };
+
+		return s_typeNames;
+	}
+
+	static const service::FieldResolverMap& getResolvers() noexcept
+	{
+		static const service::FieldResolverMap s_resolvers {
+			{ "value",
+				service::dispatchField<DelayedErrorObject, &DelayedErrorObject::resolveValue> },
+		};
+
+		return s_resolvers;
+	}
+
+	service::FieldResult<service::ResolverResult> resolveValue(service::ResolverParams&& params)
+	{
+		return service::ModifiedResult<response::StringType>::convert(
+			std::async(std::launch::async,
+				[](bool fail) {
+					std::this_thread::sleep_for(10ms);
+
+					if (fail)
+					{
+						throw std::runtime_error("delayed error");
+					}
+
+					return response::StringType { "value" };
+				},
+				_fail),
+			std::move(params));
+	}
+
+	const bool _fail;
+};
+
+TEST(ResolverResultCase, NestedListErrorPathAsync)
+{
+	auto query = R"({
+			values {
+				value
+			}
+		})"_graphql;
+	const peg::ast_node* field = nullptr;
+	const peg::ast_node* selection = nullptr;
+
+	peg::on_first_child<peg::operation_definition>(*query.root,
+		[&field, &selection](const peg::ast_node& operationDefinition) {
+			peg::on_first_child<peg::selection_set>(operationDefinition,
+				[&field, &selection](const peg::ast_node& operationSelection) {
+					field = operationSelection.children.front().get();
+					peg::on_first_child<peg::selection_set>(*field,
+						[&selection](const peg::ast_node& fieldSelection) {
+							selection = &fieldSelection;
+						});
+				});
+		});
+
+	ASSERT_NE(nullptr, selection) << "should find the selection set";
+
+	const std::shared_ptr<service::RequestState> state;
+	auto executor = std::make_shared<service::ThreadPoolExecutor>(4);
+	const response::Value emptyDirectives(response::Type::Map);
+	const response::Value variables(response::Type::Map);
+	const service::FragmentMap fragments;
+	const service::SelectionSetParams selectionSetParams {
+		service::ResolverContext::Query,
+		state,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		std::make_optional(service::field_path { nullptr, service::path_segment { "values"sv } }),
+		std::launch::async,
+		executor,
+	};
+	std::vector<std::vector<std::shared_ptr<DelayedErrorObject>>> objects(3);
+
+	for (size_t outer = 0; outer < objects.size(); ++outer)
+	{
+		for (size_t inner = 0; inner < 3; ++inner)
+		{
+			objects[outer].push_back(std::make_shared<DelayedErrorObject>(outer == 1 && inner == 2));
+		}
+	}
+
+	auto result = service::ModifiedResult<DelayedErrorObject>::convert<service::TypeModifier::List,
+		service::TypeModifier::List>(std::move(objects),
+		service::ResolverParams(selectionSetParams,
+			*field,
+			"values",
+			response::Value(response::Type::Map),
+			response::Value(response::Type::Map),
+			selection,
+			fragments,
+			variables));
+	auto document = result.get();
+
+	ASSERT_EQ(size_t(1), document.errors.size()) << "should have a single error";
+	EXPECT_EQ((service::error_path { service::path_segment { "values"sv },
+				  service::path_segment { size_t { 1 } },
+				  service::path_segment { size_t { 2 } },
+				  service::path_segment { "value"sv } }),
+		document.errors.front().path)
+		<< "should report the full path to the nested element";
+	ASSERT_TRUE(document.data.type() == response::Type::List);
+	ASSERT_EQ(size_t(3), document.data.size());
+	EXPECT_EQ("value", service::StringArgument::require("value", document.data[0][0]))
+		<< "value should match";
+}
+
+TEST(ObjectCase, BorrowedResolverTables)
+{
+	static_assert(std::is_constructible_v<service::Object, const service::TypeNames&,
+					  const service::FieldResolverMap&>,
+		"should borrow tables which outlive the Object");
+	static_assert(!std::is_constructible_v<service::Object, service::TypeNames&&,
+					  const service::FieldResolverMap&>,
+		"should not borrow a temporary TypeNames");
+	static_assert(!std::is_constructible_v<service::Object, const service::TypeNames&,
+					  service::FieldResolverMap&&>,
+		"should not borrow a temporary FieldResolverMap");
+	static_assert(!std::is_constructible_v<service::Object, service::TypeNames&&,
+					  service::FieldResolverMap&&, bool>,
+		"should not borrow temporary tables");
+}
+
+// Hand-written Object which still passes its own TypeNames and ResolverMap to the deprecated
+// constructor.
+class OwnedResolversObject : public service::Object
+{
+public:
+	OwnedResolversObject()
+		: service::Object({ "Owned" },
+			{ { "subject", [](service::ResolverParams&&) {
+				   return std::async(std::launch::deferred, []() {
+					   return service::ResolverResult { response::Value(std::string("Lunch?")) };
+				   });
+			   } } })
+	{
+	}
+};
+
+TEST(ObjectCase, OwnedResolverMap)
+{
+	auto query = R"({
+			subject
+		})"_graphql;
+	const peg::ast_node* selection = nullptr;
+
+	peg::on_first_child<peg::operation_definition>(*query.root,
+		[&selection](const peg::ast_node& operationDefinition) {
+			peg::on_first_child<peg::selection_set>(operationDefinition,
+				[&selection](const peg::ast_node& child) {
+					selection = &child;
+				});
+		});
+
+	ASSERT_NE(nullptr, selection) << "should find the selection set";
+
+	const std::shared_ptr<service::RequestState> state;
+	const response::Value emptyDirectives(response::Type::Map);
+	const response::Value variables(response::Type::Map);
+	const service::FragmentMap fragments;
+	const service::SelectionSetParams selectionSetParams {
+		service::ResolverContext::Query,
+		state,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		std::nullopt,
+	};
+	auto object = std::make_shared<OwnedResolversObject>();
+
+	EXPECT_TRUE(object->matchesType("Owned")) << "should own a copy of the type names";
+
+	auto document = object->resolve(selectionSetParams, *selection, fragments, variables).get();
+
+	EXPECT_TRUE(document.errors.empty()) << "should not have any errors";
+	ASSERT_TRUE(document.data.type() == response::Type::Map);
+	EXPECT_EQ("Lunch?", service::StringArgument::require("subject", document.data))
+		<< "should call the owned resolver";
+}
+
+// Expose the resolver lock, so the test can hold it while another thread resolves a query.
+class LockableQuery : public today::Query
+{
+public:
+	using today::Query::Query;
+
+	std::mutex& resolverMutex()
+	{
+		return _resolverMutex;
+	}
+};
+
+TEST(ObjectCase, ThreadSafeSharedQuery)
+{
+	std::atomic_size_t getAppointmentsCount = 0;
+	auto query = std::make_shared<LockableQuery>(
+		[&getAppointmentsCount]() -> std::vector<std::shared_ptr<today::Appointment>> {
+			++getAppointmentsCount;
+
+			std::string fakeAppointmentId("fakeAppointmentId");
+			response::IdType appointmentId(fakeAppointmentId.size());
+
+			std::copy(fakeAppointmentId.cbegin(), fakeAppointmentId.cend(), appointmentId.begin());
+
+			return { std::make_shared<today::Appointment>(std::move(appointmentId),
+				"tomorrow",
+				"Lunch?",
+				false) };
+		},
+		nullptr,
+		nullptr,
+		true);
+	auto service = std::make_shared<today::Operations>(query, nullptr, nullptr);
+
+	EXPECT_TRUE(query->isThreadSafe()) << "should opt in to skipping the resolver lock";
+	EXPECT_FALSE(today::Query(nullptr, nullptr, nullptr).isThreadSafe())
+		<< "should lock the resolver by default";
+
+	auto request = R"(query {
+			appointmentsById(ids: ["ZmFrZUFwcG9pbnRtZW50SWQ="]) {
+				subject
+			}
+		})"_graphql;
+
+	ASSERT_TRUE(service->validate(request).empty()) << "should pass validation";
+
+	constexpr size_t c_threadCount = 4;
+	std::vector<std::future<response::Value>> results;
+
+	results.reserve(c_threadCount);
+
+	// None of the requests could finish while this thread holds the lock, unless the resolvers
+	// skip it on the thread-safe Query.
+	std::unique_lock resolverLock { query->resolverMutex() };
+
+	for (size_t i = 0; i < c_threadCount; ++i)
+	{
+		results.push_back(std::async(std::launch::async, [&service, &request]() {
+			return service->resolve(nullptr, request, "", response::Value(response::Type::Map))
+				.get();
+		}));
+	}
+
+	for (auto& future : results)
+	{
+		ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds { 10 }))
+			<< "should not wait for the resolver lock";
+
+		const auto result = future.get();
+		const auto data = service::ScalarArgument::require("data", result);
+		const auto appointmentsById =
+			service::ScalarArgument::require<service::TypeModifier::List>("appointmentsById", data);
+
+		ASSERT_EQ(size_t(1), appointmentsById.size());
+		EXPECT_EQ("Lunch?", service::StringArgument::require("subject", appointmentsById.front()))
+			<< "subject should match";
+	}
+
+	EXPECT_EQ(size_t(1), getAppointmentsCount) << "should only load the appointments once";
+}
+
+#ifdef GRAPHQL_USE_COROUTINES
+
+// Manually resumed awaitable, which stands in for a backend I/O completion.
+struct ResumeEvent
+{
+	bool await_ready() const noexcept
+	{
+		return false;
+	}
+
+	void await_suspend(std::coroutine_handle<> handle) noexcept
+	{
+		suspended = handle;
+	}
+
+	void await_resume() const noexcept
+	{
+	}
+
+	std::coroutine_handle<> suspended;
+};
+
+service::FieldResult<response::StringType> getCoroutineSubject(ResumeEvent& event)
+{
+	co_await event;
+	co_return "Lunch?";
+}
+
+service::FieldResult<response::StringType> getCoroutineTitle(ResumeEvent& event)
+{
+	auto subject = co_await getCoroutineSubject(event);
+
+	co_return subject + " Dinner?";
+}
+
+TEST(CoroutineCase, AwaitFieldResult)
+{
+	ResumeEvent event;
+	auto result = getCoroutineTitle(event);
+
+	ASSERT_TRUE(result.is_pending()) << "should suspend until the event is resumed";
+	ASSERT_TRUE(event.suspended) << "should be waiting on the event";
+
+	std::thread([&event]() {
+		event.suspended.resume();
+	}).join();
+
+	EXPECT_FALSE(result.is_pending()) << "should finish after resuming the event";
+	EXPECT_EQ("Lunch? Dinner?", result.get()) << "should return the combined result";
+}
+
+TEST(CoroutineCase, ConvertPendingFieldResult)
+{
+	auto query = R"(query {
+			subject
+		})"_graphql;
+	const auto& field = *query.root;
+	const std::shared_ptr<service::RequestState> state;
+	const response::Value emptyDirectives(response::Type::Map);
+	const response::Value variables(response::Type::Map);
+	const service::FragmentMap fragments;
+	const service::SelectionSetParams selectionSetParams {
+		service::ResolverContext::Query,
+		state,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		std::nullopt,
+	};
+	ResumeEvent event;
+	auto future = service::StringResult::convert(getCoroutineSubject(event),
+		service::ResolverParams(selectionSetParams,
+			field,
+			"subject",
+			response::Value(response::Type::Map),
+			response::Value(response::Type::Map),
+			nullptr,
+			fragments,
+			variables));
+
+	ASSERT_TRUE(future.is_pending()) << "should not block or defer waiting for the coroutine";
+
+	event.suspended.resume();
+
+	auto result = future.get();
+
+	EXPECT_TRUE(result.errors.empty()) << "should not have any errors";
+	ASSERT_TRUE(result.data.type() == response::Type::String);
+	EXPECT_EQ("Lunch?", result.data.get<response::StringType>()) << "should return the subject";
+}
+
+service::FieldResult<std::vector<response::StringType>> getCoroutineSubjects(ResumeEvent& event)
+{
+	co_await event;
+	co_return std::vector<response::StringType> { "Lunch?", "Dinner?" };
+}
+
+TEST(CoroutineCase, ConvertPendingFieldResultList)
+{
+	auto query = R"(query {
+			subjects
+		})"_graphql;
+	const auto& field = *query.root;
+	const std::shared_ptr<service::RequestState> state;
+	const response::Value emptyDirectives(response::Type::Map);
+	const response::Value variables(response::Type::Map);
+	const service::FragmentMap fragments;
+	const service::SelectionSetParams selectionSetParams {
+		service::ResolverContext::Query,
+		state,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		std::nullopt,
+		std::launch::async,
+	};
+	ResumeEvent event;
+	auto future = service::StringResult::convert<service::TypeModifier::List>(
+		getCoroutineSubjects(event),
+		service::ResolverParams(selectionSetParams,
+			field,
+			"subjects",
+			response::Value(response::Type::Map),
+			response::Value(response::Type::Map),
+			nullptr,
+			fragments,
+			variables));
+
+	ASSERT_TRUE(future.is_pending()) << "should continue after the coroutine instead of a task";
+
+	std::thread([&event]() {
+		event.suspended.resume();
+	}).join();
+
+	ASSERT_FALSE(future.is_pending()) << "should join the list on the thread which resumed it";
+
+	auto result = future.get();
+
+	EXPECT_TRUE(result.errors.empty()) << "should not have any errors";
+	ASSERT_TRUE(result.data.type() == response::Type::List);
+	ASSERT_EQ(size_t { 2 }, result.data.size());
+	EXPECT_EQ("Lunch?", result.data[0].get<response::StringType>());
+	EXPECT_EQ("Dinner?", result.data[1].get<response::StringType>());
+}
+
+struct CoroutineAccessor
+{
+	service::FieldResult<response::StringType> getGreeting(
+		service::FieldParams&& params, response::StringType&& name) const
+	{
+		co_await event;
+
+		// Both of the reference parameters are still valid after resuming.
+		co_return name
+			+ (params.fieldDirectives.find("punctuation") == params.fieldDirectives.end() ? "?"
+																						  : "!");
+	}
+
+	ResumeEvent& event;
+};
+
+TEST(CoroutineCase, InvokeAccessorKeepsArguments)
+{
+	const std::shared_ptr<service::RequestState> state;
+	const response::Value emptyDirectives(response::Type::Map);
+	const service::SelectionSetParams selectionSetParams {
+		service::ResolverContext::Query,
+		state,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		emptyDirectives,
+		std::nullopt,
+	};
+	response::Value fieldDirectives(response::Type::Map);
+
+	fieldDirectives.emplace_back("punctuation", response::Value(response::Type::Map));
+
+	ResumeEvent event;
+	const CoroutineAccessor accessor { event };
+	auto result = service::invokeAccessor(accessor,
+		&CoroutineAccessor::getGreeting,
+		service::FieldParams(service::SelectionSetParams { selectionSetParams },
+			std::move(fieldDirectives)),
+		response::StringType { "Hello" });
+
+	ASSERT_TRUE(result.is_pending()) << "should suspend until the event is resumed";
+
+	event.suspended.resume();
+
+	EXPECT_EQ("Hello!", result.get()) << "should read the arguments after resuming";
+}
+
+#endif // GRAPHQL_USE_COROUTINES
@@ -61,6 +61,30 @@ TEST_F(ValidationExamplesCase, CounterExample91)
 		<< "error should match";
 }
 
+TEST_F(ValidationExamplesCase, TypeSystemOnlyDocument)
+{
+	auto query = R"(extend type Dog {
+			color: String
+		}
+
+		scalar Color)"_graphql;
+
+	EXPECT_FALSE(query.hasExecutableDefinitions);
+	EXPECT_TRUE(query.hasTypeSystemDefinitions);
+
+	auto errors =
+		service::buildErrorValues(_service->validate(query)).release<response::ListType>();
+
+	ASSERT_EQ(errors.size(), 2);
+	EXPECT_EQ(R"js({"message":"Unexpected type definition","locations":[{"line":1,"column":1}]})js",
+		response::toJSON(std::move(errors[0])))
+		<< "error should match";
+	EXPECT_EQ(R"js({"message":"Unexpected type definition","locations":[{"line":5,"column":3}]})js",
+		response::toJSON(std::move(errors[1])))
+		<< "error should match";
+	EXPECT_FALSE(query.validated) << "should not mark the document as validated";
+}
+
 TEST_F(ValidationExamplesCase, Example92)
 {
 	// http://spec.graphql.org/June2018/#example-069e1
@@ -2017,3 +2041,58 @@ TEST_F(ValidationExamplesCase, Example175)
 
 	ASSERT_TRUE(errors.empty());
 }
+
+TEST_F(ValidationExamplesCase, ConcurrentValidation)
+{
+	constexpr size_t threadCount = 4;
+	std::vector<std::future<std::pair<size_t, size_t>>> results;
+
+	results.reserve(threadCount);
+
+	for (size_t i = 0; i < threadCount; ++i)
+	{
+		results.push_back(std::async(std::launch::async, []() {
+			size_t validCount = 0;
+			size_t errorCount = 0;
+
+			for (size_t j = 0; j < 50; ++j)
+			{
+				auto validQuery = R"(query booleanArgQueryWithDefault($booleanArg: Boolean) {
+						arguments {
+							optionalNonNullBooleanArgField(optionalBooleanArg: $booleanArg)
+						}
+						dog {
+							...fragmentOne
+						}
+					}
+
+					fragment fragmentOne on Dog {
+						name
+					})"_graphql;
+				auto invalidQuery = R"(query getDogName {
+						dog {
+							name
+							color
+						}
+					})"_graphql;
+
+				if (_service->validate(validQuery).empty())
+				{
+					++validCount;
+				}
+
+				errorCount += _service->validate(invalidQuery).size();
+			}
+
+			return std::make_pair(validCount, errorCount);
+		}));
+	}
+
+	for (auto& result : results)
+	{
+		const auto [validCount, errorCount] = result.get();
+
+		EXPECT_EQ(size_t(50), validCount) << "every valid query should pass validation";
+		EXPECT_EQ(size_t(50), errorCount) << "every invalid query should have 1 error";
+	}
+}